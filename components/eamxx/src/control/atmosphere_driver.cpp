@@ -12,6 +12,7 @@
 #include "share/util/eamxx_timing.hpp"
 #include "share/util/eamxx_utils.hpp"
 #include "share/io/eamxx_io_utils.hpp"
+#include "share/grid/remap/horiz_interp_remapper_data.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -256,6 +257,11 @@ void AtmosphereDriver::create_grids()
   // Must have procs created by now (and comm/params set)
   check_ad_status (s_procs_created | s_comm_set | s_params_set | s_ts_inited);
 
+  // Horizontal remappers are created during grids/output setup, so set the
+  // location of their on-disk data cache (if any) right away
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  HorizRemapperData::set_cache_dir(driver_options_pl.get<std::string>("horiz_remap_cache_dir",""));
+
   // Create the grids manager
   auto& gm_params = m_atm_params.sublist("grids_manager");
   const std::string& gm_type = gm_params.get<std::string>("Type");
@@ -269,7 +275,8 @@ void AtmosphereDriver::create_grids()
     const auto& provenance = m_atm_params.sublist("provenance");
     const auto& casename = provenance.get<std::string>("rest_caseid");
     auto filename = find_filename_in_rpointer (casename+".scream",true,m_atm_comm,m_run_t0);
-    gm_params.set("ic_filename", filename);
+    // An incremental restart file may not contain static data, but the full one does
+    gm_params.set("ic_filename", get_full_restart_filename(filename));
     m_atm_params.sublist("provenance").set("initial_conditions_file",filename);
   } else if (ic_pl.isParameter("Filename")) {
     // Initial run, if an IC file is present, pass it.
@@ -932,6 +939,16 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  // Keep the file open while we query/read it, to avoid re-opening it for each grid
+  scorpio::register_file(filename,scorpio::Read);
+
+  // An incremental restart file only contains the fields that changed since the
+  // last full restart file. The other fields must be read from the latter.
+  const auto full_filename = get_full_restart_filename(filename);
+  if (full_filename!=filename) {
+    m_atm_logger->info("    [EAMxx] Full restart filename: " + full_filename);
+  }
+
   for (auto& gn : m_grids_manager->get_grid_names()) {
     if (fvphyshack and gn == "Physics GLL") continue;
     if (not m_field_mgr->has_group("RESTART", gn)) {
@@ -939,14 +956,22 @@ void AtmosphereDriver::restart_model ()
       continue;
     }
     const auto& restart_group = m_field_mgr->get_group_info("RESTART", gn);
-    std::vector<Field> fields;
+    std::vector<Field> fields, full_restart_fields;
     for (const auto& fn : restart_group.m_fields_names) {
-      fields.push_back(m_field_mgr->get_field(fn,gn));
+      if (full_filename==filename or scorpio::has_var(filename,fn)) {
+        fields.push_back(m_field_mgr->get_field(fn,gn));
+      } else {
+        full_restart_fields.push_back(m_field_mgr->get_field(fn,gn));
+      }
     }
     read_fields_from_file (fields,m_grids_manager->get_grid(gn),filename);
+    read_fields_from_file (full_restart_fields,m_grids_manager->get_grid(gn),full_filename);
     for (auto& f : fields) {
       f.get_header().get_tracking().update_time_stamp(m_current_ts);
     }
+    for (auto& f : full_restart_fields) {
+      f.get_header().get_tracking().update_time_stamp(m_current_ts);
+    }
   }
 
   // Restart the num steps counter in the atm time stamp
@@ -976,6 +1001,8 @@ void AtmosphereDriver::restart_model ()
     }
   }
 
+  scorpio::release_file(filename);
+
   m_atm_logger->info("  [EAMxx] restart_model ... done!");
 }
 
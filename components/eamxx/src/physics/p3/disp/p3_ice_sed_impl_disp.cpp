@@ -29,6 +29,7 @@ void Functions<Real,DefaultDevice>
   const uview_1d<Scalar>& precip_ice_surf,
   const uview_1d<bool>& nucleationPossible,
   const uview_1d<bool>& hydrometeorsPresent,
+  const uview_1d<const Int>& active_cols,
   const P3Runtime& runtime_options)
 {
   using ExeSpace = typename KT::ExeSpace;
@@ -38,7 +39,7 @@ void Functions<Real,DefaultDevice>
   Kokkos::parallel_for("p3_ice_sedimentation",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
@@ -71,7 +72,8 @@ void Functions<Real,DefaultDevice>
   const uview_2d<Spack>& bm,
   const uview_2d<Spack>& th_atm,
   const uview_1d<bool>& nucleationPossible,
-  const uview_1d<bool>& hydrometeorsPresent)
+  const uview_1d<bool>& hydrometeorsPresent,
+  const uview_1d<const Int>& active_cols)
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
@@ -81,7 +83,7 @@ void Functions<Real,DefaultDevice>
     "p3_homogeneous",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
@@ -227,6 +227,7 @@ Int Functions<Real,DefaultDevice>
   auto flux_qit                = temporaries.flux_qit;
   auto v_qr                    = temporaries.v_qr;
   auto v_nr                    = temporaries.v_nr;
+  auto active_cols             = temporaries.active_cols;
 
   // we do not want to measure init stuff
   auto start = std::chrono::steady_clock::now();
@@ -252,11 +253,29 @@ Int Functions<Real,DefaultDevice>
       bm, qc_incld, qr_incld, qi_incld, qm_incld, nc_incld, nr_incld,
       ni_incld, bm_incld, nucleationPossible, hydrometeorsPresent, runtime_options);
 
+  // Build the list of columns the remaining kernels are launched on. If compaction
+  // is on, only keep columns where part1 found some work to do, so that
+  // clear-sky columns do not occupy teams in the kernels below.
+  const bool compact = runtime_options.compact_active_columns;
+  EKAT_REQUIRE_MSG (active_cols.extent_int(0)>=nj,
+      "Error! The active_cols temporary is too small for the number of columns.\n");
+  Int nj_active = 0;
+  Kokkos::parallel_scan("p3_active_cols",
+      Kokkos::RangePolicy<ExeSpace>(0, nj), KOKKOS_LAMBDA (const Int i, Int& offset, const bool final) {
+    const bool active = !compact || nucleationPossible(i) || hydrometeorsPresent(i);
+    if (active) {
+      if (final) {
+        active_cols(offset) = i;
+      }
+      ++offset;
+    }
+  }, nj_active);
+
   // ------------------------------------------------------------------------------------------
   // main k-loop (for processes):
 
   p3_main_part2_disp(
-      nj, nk, runtime_options.max_total_ni, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt, inv_dt,
+      nj_active, nk, runtime_options.max_total_ni, infrastructure.predictNc, infrastructure.prescribedCCN, infrastructure.dt, inv_dt,
       hetfrz_immersion_nucleation_tend, hetfrz_contact_nucleation_tend, hetfrz_deposition_nucleation_tend,
       lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals,
       lookup_tables.revap_table_vals, pres, dpres, dz, nc_nuceat_tend, inv_exner,
@@ -266,7 +285,7 @@ Int Functions<Real,DefaultDevice>
       nr_incld, ni_incld, bm_incld, mu_c, nu, lamc, cdist, cdist1, cdistr,
       mu_r, lamr, logn0r, qv2qi_depos_tend, precip_total_tend, nevapr, qr_evap_tend,
       vap_liq_exchange, vap_ice_exchange, liq_ice_exchange,
-      pratot, prctot, nucleationPossible, hydrometeorsPresent, runtime_options);
+      pratot, prctot, nucleationPossible, hydrometeorsPresent, active_cols, runtime_options);
 
   //NOTE: At this point, it is possible to have negative (but small) nc, nr, ni.  This is not
   //      a problem; those values get clipped to zero in the sedimentation section (if necessary).
@@ -282,30 +301,30 @@ Int Functions<Real,DefaultDevice>
   // Cloud sedimentation:  (adaptive substepping)
   cloud_sedimentation_disp(
       qc_incld, rho, inv_rho, cld_frac_l, acn, inv_dz, lookup_tables.dnu_table_vals, workspace_mgr,
-      nj, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
+      nj_active, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, infrastructure.predictNc,
       qc, nc, nc_incld, mu_c, lamc, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent);
+      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent, active_cols);
 
 
   // Rain sedimentation:  (adaptive substepping)
   rain_sedimentation_disp(
       rho, inv_rho, rhofacr, cld_frac_r, inv_dz, qr_incld, workspace_mgr,
-      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nj, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, qr,
+      lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, nj_active, nk, ktop, kbot, kdir, infrastructure.dt, inv_dt, qr,
       nr, nr_incld, mu_r, lamr, precip_liq_flux, qtend_ignore, ntend_ignore,
-      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent, runtime_options);
+      diagnostic_outputs.precip_liq_surf, nucleationPossible, hydrometeorsPresent, active_cols, runtime_options);
 
   // Ice sedimentation:  (adaptive substepping)
   ice_sedimentation_disp(
-      rho, inv_rho, rhofaci, cld_frac_i, inv_dz, workspace_mgr, nj, nk, ktop, kbot,
+      rho, inv_rho, rhofaci, cld_frac_i, inv_dz, workspace_mgr, nj_active, nk, ktop, kbot,
       kdir, infrastructure.dt, inv_dt, qi, qi_incld, ni, ni_incld,
       qm, qm_incld, bm, bm_incld, qtend_ignore, ntend_ignore,
-      lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf, nucleationPossible, hydrometeorsPresent, runtime_options);
+      lookup_tables.ice_table_vals, diagnostic_outputs.precip_ice_surf, nucleationPossible, hydrometeorsPresent, active_cols, runtime_options);
 
   // homogeneous freezing f cloud and rain
   if(do_ice_production) {
-    homogeneous_freezing_disp(T_atm, inv_exner, nj, nk, ktop, kbot, kdir, qc,
+    homogeneous_freezing_disp(T_atm, inv_exner, nj_active, nk, ktop, kbot, kdir, qc,
                               nc, qr, nr, qi, ni, qm, bm, th,
-                              nucleationPossible, hydrometeorsPresent);
+                              nucleationPossible, hydrometeorsPresent, active_cols);
   }
 
   //
@@ -313,12 +332,12 @@ Int Functions<Real,DefaultDevice>
   // and compute diagnostic fields for output
   //
   p3_main_part3_disp(
-      nj, nk_pack, runtime_options.max_total_ni, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, inv_exner, cld_frac_l, cld_frac_r, cld_frac_i,
+      nj_active, nk_pack, runtime_options.max_total_ni, lookup_tables.dnu_table_vals, lookup_tables.ice_table_vals, inv_exner, cld_frac_l, cld_frac_r, cld_frac_i,
       rho, inv_rho, rhofaci, qv, th, qc, nc, qr, nr, qi, ni,
       qm, bm, mu_c, nu, lamc, mu_r, lamr,
       vap_liq_exchange, ze_rain, ze_ice, diag_vm_qi, diag_eff_radius_qi, diag_diam_qi,
       rho_qi, diag_equiv_reflectivity, diag_eff_radius_qc, diag_eff_radius_qr, nucleationPossible, hydrometeorsPresent,
-      runtime_options);
+      active_cols, runtime_options);
 
   //
   // merge ice categories with similar properties
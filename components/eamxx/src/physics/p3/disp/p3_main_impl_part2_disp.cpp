@@ -93,11 +93,15 @@ void Functions<Real,DefaultDevice>
   const uview_2d<Spack>& prctot,
   const uview_1d<bool>& nucleationPossible,
   const uview_1d<bool>& hydrometeorsPresent,
+  const uview_1d<const Int>& active_cols,
   const P3Runtime& runtime_options)
 {
   using ExeSpace = typename KT::ExeSpace;
   const Int nk_pack = ekat::npack<Spack>(nk);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack);
+  // Size the teams on the packs below the process rates top level, since
+  // the ones above it are never processed
+  const Int nk_pack_active = nk_pack - runtime_options.process_rates_top_level/Spack::n;
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(nj, nk_pack_active);
 
 
   // p3_cloud_sedimentation loop
@@ -105,7 +109,7 @@ void Functions<Real,DefaultDevice>
     "p3_main_part2_disp",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
@@ -55,6 +55,7 @@ void Functions<Real,DefaultDevice>
   const uview_2d<Spack>& diag_eff_radius_qr,
   const uview_1d<bool>& nucleationPossible,
   const uview_1d<bool>& hydrometeorsPresent,
+  const uview_1d<const Int>& active_cols,
   const P3Runtime& runtime_options)
 {
   using ExeSpace = typename KT::ExeSpace;
@@ -64,7 +65,7 @@ void Functions<Real,DefaultDevice>
     "p3_main_part3_disp",
     policy, KOKKOS_LAMBDA(const MemberType& team) {
 
-    const Int i = team.league_rank();
+    const Int i = active_cols(team.league_rank());
     if (!(nucleationPossible(i) || hydrometeorsPresent(i))) {
       return;
     }
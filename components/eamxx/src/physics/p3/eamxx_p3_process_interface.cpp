@@ -37,6 +37,11 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
 
   // Gather runtime options from file
   runtime_options.load_runtime_options_from_file(m_params);
+  EKAT_REQUIRE_MSG (runtime_options.process_rates_top_level>=0 and
+                    runtime_options.process_rates_top_level<m_num_levs,
+      "Error! Invalid value for P3 process_rates_top_level.\n"
+      "  - value: " + std::to_string(runtime_options.process_rates_top_level) + "\n"
+      "  - valid range: [0," + std::to_string(m_num_levs-1) + "]\n");
 
   // --Infrastructure
   // dt is passed as an argument to run_impl
@@ -151,7 +156,7 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
   const Int nk_pack_p1 = ekat::npack<Spack>(m_num_levs+1);
 
   // Number of Reals needed by local views in the interface
-  const size_t interface_request =
+  size_t interface_request =
       // 1d view scalar, size (ncol)
       Buffer::num_1d_scalar*m_num_cols*sizeof(Real) +
       // 2d view packed, size (ncol, nlev_packs)
@@ -159,6 +164,10 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
       Buffer::num_2dp1_vector*m_num_cols*nk_pack_p1*sizeof(Spack) +
       // 2d view scalar, size (ncol, 3)
       m_num_cols*3*sizeof(Real);
+#ifdef SCREAM_P3_SMALL_KERNELS
+  // 1d view int, size (ncol), padded to a whole number of Reals
+  interface_request += (m_num_cols*sizeof(Int) + sizeof(Real) - 1)/sizeof(Real)*sizeof(Real);
+#endif
 
   // Number of Reals needed by the WorkspaceManager passed to p3_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
@@ -188,6 +197,12 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
   m_buffer.col_location = decltype(m_buffer.col_location)(mem, m_num_cols, 3);
   mem += m_buffer.col_location.size();
 
+#ifdef SCREAM_P3_SMALL_KERNELS
+  // 1d int views. Pad to a whole number of Reals, to keep the views below aligned
+  m_buffer.active_cols = decltype(m_buffer.active_cols)(reinterpret_cast<Int*>(mem), m_num_cols);
+  mem += (m_num_cols*sizeof(Int) + sizeof(Real) - 1)/sizeof(Real);
+#endif
+
   Spack* s_mem = reinterpret_cast<Spack*>(mem);
 
   // 2d packed views
@@ -437,6 +452,7 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   temporaries.flux_qit                = m_buffer.flux_qit;
   temporaries.v_qr                    = m_buffer.v_qr;
   temporaries.v_nr                    = m_buffer.v_nr;
+  temporaries.active_cols             = m_buffer.active_cols;
 #endif
 
   // -- Set values for the post-amble structure
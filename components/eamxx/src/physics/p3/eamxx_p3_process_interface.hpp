@@ -32,12 +32,14 @@ class P3Microphysics : public AtmosphereProcess
   using WSM          = ekat::WorkspaceManager<Spack, KT::Device>;
 
   using view_1d  = typename P3F::view_1d<Real>;
+  using view_1d_int = typename P3F::view_1d<Int>;
   using view_1d_const  = typename P3F::view_1d<const Real>;
   using view_2d  = typename P3F::view_2d<Spack>;
   using view_2d_const  = typename P3F::view_2d<const Spack>;
   using sview_2d = typename KokkosTypes<DefaultDevice>::template view_2d<Real>;
 
   using uview_1d  = Unmanaged<view_1d>;
+  using uview_1d_int = Unmanaged<view_1d_int>;
   using uview_2d  = Unmanaged<view_2d>;
   using suview_2d = Unmanaged<sview_2d>;
 
@@ -423,6 +425,7 @@ public:
       mu_c, lamc, qr_evap_tend, v_qc, v_nc, flux_qx, flux_nx,
       v_qit, v_nit, flux_nit, flux_bir, flux_qir, flux_qit,
       v_qr, v_nr;
+    uview_1d_int active_cols;
 #endif
 
     suview_2d col_location;
@@ -111,21 +111,62 @@ void Functions<S,D>
   const bool use_hetfrz_classnuc = runtime_options.use_hetfrz_classnuc;
   const bool use_separate_ice_liq_frac = runtime_options.use_separate_ice_liq_frac;
 
-  team.team_barrier();
-  hydrometeorsPresent = false;
-  team.team_barrier();
-
-  Kokkos::parallel_for(
-    Kokkos::TeamVectorRange(team, nk_pack), [&] (Int k) {
+  // Levels above this one are never processed (defaults to the model top)
+  const Int top_level = runtime_options.process_rates_top_level;
 
+  // if relatively dry and no hydrometeors at this level, skip to end of k-loop (i.e. skip this level)
+  auto get_skip_all = [&] (const Int k) {
     //compute mask to identify padded values in packs, which shouldn't be used in calculations
     const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
-    const auto range_mask = range_pack < nk;
+    const auto range_mask = range_pack < nk && range_pack >= top_level;
 
-    // if relatively dry and no hydrometeors at this level, skip to end of k-loop (i.e. skip this level)
-    const auto skip_all = ( !range_mask ||
+    return ( !range_mask ||
         (qc(k)<qsmall && qr(k)<qsmall && qi(k)<qsmall &&
          T_atm(k)<T_zerodegc && qv_supersat_i(k)< -0.05) );
+  };
+
+  team.team_barrier();
+  hydrometeorsPresent = false;
+  team.team_barrier();
+
+  // Levels above top_level skip the process rates, but their hydrometeors
+  // still have to sediment, so they must be accounted for in hydrometeorsPresent
+  if (top_level>0) {
+    Int above_top_present = 0;
+    Kokkos::parallel_reduce(
+      Kokkos::TeamVectorRange(team, ekat::impl::min(ekat::npack<Spack>(top_level),nk_pack)), [&] (Int k, Int& lpresent) {
+      const auto range_pack = ekat::range<IntSmallPack>(k*Spack::n);
+      const auto above_top = range_pack < nk && range_pack < top_level;
+      if ((above_top && (qc(k)>=qsmall || qr(k)>=qsmall || qi(k)>=qsmall)).any()) {
+        lpresent = 1;
+      }
+    }, Kokkos::Max<Int>(above_top_present));
+    if (above_top_present) {
+      hydrometeorsPresent = true;
+    }
+  }
+
+  // Find the range of packs with some level not entirely skipped. Packs outside
+  // of it would return right away in the main loop, so trimming the loop range
+  // avoids scheduling idle vector lanes on them.
+  Kokkos::MinMaxScalar<Int> active_packs;
+  Kokkos::parallel_reduce(
+    Kokkos::TeamVectorRange(team, top_level/Spack::n, nk_pack), [&] (Int k, Kokkos::MinMaxScalar<Int>& lminmax) {
+    if (not get_skip_all(k).all()) {
+      lminmax.min_val = ekat::impl::min(lminmax.min_val,k);
+      lminmax.max_val = ekat::impl::max(lminmax.max_val,k);
+    }
+  }, Kokkos::MinMax<Int>(active_packs));
+
+  if (active_packs.min_val>active_packs.max_val) {
+    // Nothing to do for this column
+    return;
+  }
+
+  Kokkos::parallel_for(
+    Kokkos::TeamVectorRange(team, active_packs.min_val, active_packs.max_val+1), [&] (Int k) {
+
+    const auto skip_all = get_skip_all(k);
 
     if (skip_all.all()) {
       return; // skip all process rates
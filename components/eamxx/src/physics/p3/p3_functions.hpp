@@ -131,12 +131,17 @@ struct Functions
     Scalar immersion_freezing_exponent = 0.65;
     Scalar deposition_nucleation_exponent = 0.304;
     Scalar ice_sedimentation_factor = 1.0;
+    // Levels above this one (smaller index) are skipped in the process rates loop
+    Int process_rates_top_level = 0;
     bool do_ice_production = true;
     bool set_cld_frac_l_to_one = false;
     bool set_cld_frac_i_to_one = false;
     bool set_cld_frac_r_to_one = false;
     bool use_hetfrz_classnuc   = false;
     bool use_separate_ice_liq_frac = false;
+    // Small kernels only: launch the kernels following p3_main_part1 only on
+    // the columns where part1 found hydrometeors or possible nucleation
+    bool compact_active_columns = false;
 
     void load_runtime_options_from_file(ekat::ParameterList& params) {
       max_total_ni = params.get<double>("max_total_ni", max_total_ni);
@@ -159,12 +164,14 @@ struct Functions
       immersion_freezing_exponent = params.get<double>("immersion_freezing_exponent", immersion_freezing_exponent);
       deposition_nucleation_exponent = params.get<double>("deposition_nucleation_exponent", deposition_nucleation_exponent);
       ice_sedimentation_factor = params.get<double>("ice_sedimentation_factor", ice_sedimentation_factor);
+      process_rates_top_level = params.get<int>("process_rates_top_level", process_rates_top_level);
       do_ice_production = params.get<bool>("do_ice_production", do_ice_production);
       set_cld_frac_l_to_one = params.get<bool>("set_cld_frac_l_to_one", set_cld_frac_l_to_one);
       set_cld_frac_i_to_one = params.get<bool>("set_cld_frac_i_to_one", set_cld_frac_i_to_one);
       set_cld_frac_r_to_one = params.get<bool>("set_cld_frac_r_to_one", set_cld_frac_r_to_one);
       use_hetfrz_classnuc   = params.get<bool>("use_hetfrz_classnuc", use_hetfrz_classnuc);
       use_separate_ice_liq_frac = params.get<bool>("use_separate_ice_liq_frac", use_separate_ice_liq_frac);
+      compact_active_columns = params.get<bool>("compact_active_columns", compact_active_columns);
     }
 
   };
@@ -343,6 +350,8 @@ struct Functions
     view_2d<Spack> flux_qir, flux_qit;
     // rain sedimentation
     view_2d<Spack> v_qr, v_nr;
+    // columns the kernels following p3_main_part1 are launched on
+    view_1d<Int> active_cols;
   };
 #endif
 
@@ -545,7 +554,8 @@ struct Functions
     const uview_2d<Spack>& nc_tend,
     const uview_1d<Scalar>& precip_liq_surf,
     const uview_1d<bool>& is_nucleat_possible,
-    const uview_1d<bool>& is_hydromet_present);
+    const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols);
 #endif
 
   // TODO: comment
@@ -594,6 +604,7 @@ struct Functions
     const uview_1d<Scalar>& precip_liq_surf,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
     const P3Runtime& runtime_options);
 #endif
 
@@ -645,6 +656,7 @@ struct Functions
     const uview_1d<Scalar>& precip_ice_surf,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
     const P3Runtime& runtime_options);
 #endif
 
@@ -680,7 +692,8 @@ struct Functions
     const uview_2d<Spack>& bm,
     const uview_2d<Spack>& th_atm,
     const uview_1d<bool>& is_nucleat_possible,
-    const uview_1d<bool>& is_hydromet_present);
+    const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols);
 #endif
 
   // -- Find layers
@@ -1306,6 +1319,7 @@ struct Functions
     const uview_2d<Spack>& prctot,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
     const P3Runtime& runtime_options);
 #endif
 
@@ -1391,6 +1405,7 @@ struct Functions
     const uview_2d<Spack>& diag_eff_radius_qr,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
+    const uview_1d<const Int>& active_cols,
     const P3Runtime& runtime_options);
 #endif
 
@@ -12,6 +12,8 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <cmath>
+#include <limits>
 
 namespace scream {
 namespace p3 {
@@ -35,9 +37,178 @@ void run_phys_p3_main_part3()
   // TODO
 }
 
+using P3Runtime = Functions<Real,DefaultDevice>::P3Runtime;
+
+static void run_p3_main_host(P3MainData& d, const P3Runtime& runtime_options)
+{
+  p3_main_host(
+    d.qc, d.nc, d.qr, d.nr, d.th_atm, d.qv, d.dt, d.qi, d.qm, d.ni,
+    d.bm, d.pres, d.dz, d.nc_nuceat_tend, d.nccn_prescribed, d.ni_activated, d.inv_qc_relvar, d.it, d.precip_liq_surf,
+    d.precip_ice_surf, d.its, d.ite, d.kts, d.kte, d.diag_eff_radius_qc, d.diag_eff_radius_qi, d.diag_eff_radius_qr,
+    d.rho_qi, d.do_predict_nc, d.do_prescribed_CCN, d.use_hetfrz_classnuc, d.dpres, d.inv_exner, d.qv2qi_depos_tend,
+    d.precip_liq_flux, d.precip_ice_flux, d.cld_frac_r, d.cld_frac_l, d.cld_frac_i,
+    d.liq_ice_exchange, d.vap_liq_exchange, d.vap_ice_exchange, d.qv_prev, d.t_prev,
+    runtime_options);
+}
+
 void run_phys_p3_main()
 {
-  // TODO
+  // Launching the kernels only on active columns must not change the answer.
+  // Note: compaction is only done by the small kernels version of p3_main
+  auto engine = Base::get_engine();
+
+  P3MainData d(1, 10, 1, 72, 1, 1.800E+03, true, false);
+  d.randomize(engine, {
+      {d.pres           , {1.00000000E+02 , 9.87111111E+04}},
+      {d.dz             , {1.22776609E+02 , 3.49039167E+04}},
+      {d.nc_nuceat_tend , {0              , 0}},
+      {d.nccn_prescribed, {0              , 0}},
+      {d.ni_activated   , {0              , 0}},
+      {d.dpres          , {1.37888889E+03, 1.39888889E+03}},
+      {d.inv_exner      , {1.00371345E+00, 3.19721007E+00}},
+      {d.cld_frac_i     , {1              , 1}},
+      {d.cld_frac_l     , {1              , 1}},
+      {d.cld_frac_r     , {1              , 1}},
+      {d.inv_qc_relvar  , {1              , 1}},
+      {d.qc             , {0              , 1.00000000E-04}},
+      {d.nc             , {1.00000000E+06 , 1.00000000E+06}},
+      {d.qr             , {0              , 1.00000000E-05}},
+      {d.nr             , {1.00000000E+06 , 1.00000000E+06}},
+      {d.qi             , {0              , 1.00000000E-04}},
+      {d.qm             , {0              , 1.00000000E-04}},
+      {d.ni             , {1.00000000E+06 , 1.00000000E+06}},
+      {d.bm             , {0              , 1.00000000E-02}},
+      {d.qv             , {0              , 5.00000000E-02}},
+      {d.qv_prev        , {0              , 5.00000000E-02}},
+      {d.th_atm         , {6.72653866E+02 , 1.07954335E+03}},
+      {d.t_prev         , {1.50000000E+02 , 3.50000000E+02}}
+  });
+
+  // Make every other column dry, so that part1 finds nothing to do there
+  const Int nj = d.ite - d.its + 1;
+  const Int nk = d.kte - d.kts + 1;
+  for (Int i = 1; i < nj; i += 2) {
+    for (Int k = 0; k < nk; ++k) {
+      const Int t = i*nk + k;
+      d.qc[t] = d.qr[t] = d.qi[t] = d.qm[t] = d.bm[t] = 0;
+      d.qv[t] = d.qv_prev[t] = 0;
+    }
+  }
+
+  P3MainData d_full(d), d_compact(d);
+  P3Runtime compact_options;
+  compact_options.compact_active_columns = true;
+  run_p3_main_host(d_full, P3Runtime());
+  run_p3_main_host(d_compact, compact_options);
+
+  const auto tot = d.total(d.qc);
+  for (Int t = 0; t < tot; ++t) {
+    REQUIRE(d_full.qc[t]                 == d_compact.qc[t]);
+    REQUIRE(d_full.nc[t]                 == d_compact.nc[t]);
+    REQUIRE(d_full.qr[t]                 == d_compact.qr[t]);
+    REQUIRE(d_full.nr[t]                 == d_compact.nr[t]);
+    REQUIRE(d_full.qi[t]                 == d_compact.qi[t]);
+    REQUIRE(d_full.qm[t]                 == d_compact.qm[t]);
+    REQUIRE(d_full.ni[t]                 == d_compact.ni[t]);
+    REQUIRE(d_full.bm[t]                 == d_compact.bm[t]);
+    REQUIRE(d_full.qv[t]                 == d_compact.qv[t]);
+    REQUIRE(d_full.th_atm[t]             == d_compact.th_atm[t]);
+    REQUIRE(d_full.diag_eff_radius_qc[t] == d_compact.diag_eff_radius_qc[t]);
+    REQUIRE(d_full.diag_eff_radius_qi[t] == d_compact.diag_eff_radius_qi[t]);
+    REQUIRE(d_full.diag_eff_radius_qr[t] == d_compact.diag_eff_radius_qr[t]);
+    REQUIRE(d_full.rho_qi[t]             == d_compact.rho_qi[t]);
+    REQUIRE(d_full.qv2qi_depos_tend[t]   == d_compact.qv2qi_depos_tend[t]);
+    REQUIRE(d_full.liq_ice_exchange[t]   == d_compact.liq_ice_exchange[t]);
+    REQUIRE(d_full.vap_liq_exchange[t]   == d_compact.vap_liq_exchange[t]);
+    REQUIRE(d_full.vap_ice_exchange[t]   == d_compact.vap_ice_exchange[t]);
+  }
+  const auto tot_flux = d.total(d.precip_liq_flux);
+  for (Int t = 0; t < tot_flux; ++t) {
+    REQUIRE(d_full.precip_liq_flux[t]    == d_compact.precip_liq_flux[t]);
+    REQUIRE(d_full.precip_ice_flux[t]    == d_compact.precip_ice_flux[t]);
+  }
+  const auto tot_surf = d.total(d.precip_liq_surf);
+  for (Int t = 0; t < tot_surf; ++t) {
+    REQUIRE(d_full.precip_liq_surf[t]    == d_compact.precip_liq_surf[t]);
+    REQUIRE(d_full.precip_ice_surf[t]    == d_compact.precip_ice_surf[t]);
+  }
+}
+
+void run_phys_p3_main_top_level()
+{
+  // Hydrometeors above process_rates_top_level skip the process rates, but
+  // they must still sediment into the levels below it, conserving water.
+  auto engine = Base::get_engine();
+
+  P3MainData d(1, 10, 1, 72, 1, 1.800E+03, true, false);
+  d.randomize(engine, {
+      {d.pres           , {1.00000000E+02 , 9.87111111E+04}},
+      {d.dz             , {1.22776609E+02 , 3.49039167E+04}},
+      {d.nc_nuceat_tend , {0              , 0}},
+      {d.nccn_prescribed, {0              , 0}},
+      {d.ni_activated   , {0              , 0}},
+      {d.dpres          , {1.37888889E+03, 1.39888889E+03}},
+      {d.inv_exner      , {1              , 1}},
+      {d.cld_frac_i     , {1              , 1}},
+      {d.cld_frac_l     , {1              , 1}},
+      {d.cld_frac_r     , {1              , 1}},
+      {d.inv_qc_relvar  , {1              , 1}},
+      {d.qc             , {1.00000000E-05 , 1.00000000E-04}},
+      {d.nc             , {1.00000000E+06 , 1.00000000E+06}},
+      {d.qr             , {1.00000000E-05 , 1.00000000E-04}},
+      {d.nr             , {1.00000000E+06 , 1.00000000E+06}},
+      {d.qi             , {1.00000000E-05 , 1.00000000E-04}},
+      {d.qm             , {0              , 0}},
+      {d.ni             , {1.00000000E+06 , 1.00000000E+06}},
+      {d.bm             , {0              , 0}},
+      {d.qv             , {0              , 0}},
+      {d.qv_prev        , {0              , 0}},
+      {d.th_atm         , {2.50000000E+02 , 2.50000000E+02}},
+      {d.t_prev         , {2.50000000E+02 , 2.50000000E+02}}
+  });
+
+  // Keep the condensate above the top level only. The atmosphere is cold and
+  // dry, so nucleation is not possible and only the hydrometeors above the top
+  // level can get the column processed.
+  const Int nj = d.ite - d.its + 1;
+  const Int nk = d.kte - d.kts + 1;
+  const Int top_level = nk/2;
+  for (Int i = 0; i < nj; ++i) {
+    for (Int k = top_level; k < nk; ++k) {
+      const Int t = i*nk + k;
+      d.qc[t] = d.nc[t] = d.qr[t] = d.nr[t] = d.qi[t] = d.ni[t] = 0;
+    }
+  }
+
+  // Column water mass, in kg/m2
+  auto column_water = [&] (const P3MainData& data, const Int i) {
+    Real mass = 0;
+    for (Int k = 0; k < nk; ++k) {
+      const Int t = i*nk + k;
+      mass += (data.qv[t] + data.qc[t] + data.qr[t] + data.qi[t])*data.dpres[t]/C::gravit;
+    }
+    return mass;
+  };
+
+  P3MainData d_top(d);
+  P3Runtime top_options;
+  top_options.process_rates_top_level = top_level;
+  run_p3_main_host(d_top, top_options);
+
+  const Real tol = std::sqrt(std::numeric_limits<Real>::epsilon());
+  for (Int i = 0; i < nj; ++i) {
+    // Condensate has fallen below the top level
+    bool below_top = false;
+    for (Int k = top_level; k < nk; ++k) {
+      const Int t = i*nk + k;
+      below_top = below_top || d_top.qc[t]>0 || d_top.qr[t]>0 || d_top.qi[t]>0;
+    }
+    REQUIRE(below_top);
+
+    // Water is only moved around, or out of the column as surface precipitation
+    const Real surf = (d_top.precip_liq_surf[i] + d_top.precip_ice_surf[i])*C::RHO_H2O*d.dt;
+    REQUIRE(std::abs(column_water(d_top,i) + surf - column_water(d,i)) <= tol*column_water(d,i));
+  }
 }
 
 void run_phys()
@@ -46,6 +217,7 @@ void run_phys()
   run_phys_p3_main_part2();
   run_phys_p3_main_part3();
   run_phys_p3_main();
+  run_phys_p3_main_top_level();
 }
 
 void run_bfb_p3_main_part1()
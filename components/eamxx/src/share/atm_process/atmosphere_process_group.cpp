@@ -7,6 +7,7 @@
 #include "ekat/util/ekat_string_utils.hpp"
 
 #include <memory>
+#include <set>
 
 namespace scream {
 
@@ -24,7 +25,6 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
       m_group_schedule_type = ScheduleType::Sequential;
     } else if (m_params.get<std::string>("schedule_type") == "Parallel") {
       m_group_schedule_type = ScheduleType::Parallel;
-      ekat::error::runtime_abort("Error! Parallel schedule not yet implemented.\n");
     } else {
       ekat::error::runtime_abort("Error! Invalid 'schedule_type'. Available choices are 'Parallel' and 'Sequential'.\n");
     }
@@ -46,25 +46,13 @@ AtmosphereProcessGroup (const ekat::Comm& comm, const ekat::ParameterList& param
   // so we don't expect users to register the APG in the factory.
   apf.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
   for (const auto& ap_name : group_list) {
-    // The comm to be passed to the processes construction is
-    //  - the same as the comm of this APG, if num_entries=1 or sched_type=Sequential
-    //  - a sub-comm of this APG's comm otherwise
+    // The comm to be passed to the processes construction is the same as the comm
+    // of this APG. In parallel splitting, processes are still run by all ranks,
+    // but they all start from the same state (see run_parallel).
+    // NOTE: a different design, where each rank runs only a subset of the
+    //       processes in the group, would require remapping input/output fields
+    //       to/from sub-comms. That is not currently supported.
     ekat::Comm proc_comm = m_comm;
-    if (m_group_schedule_type==ScheduleType::Parallel) {
-      // This is what's going to happen when we implment this:
-      //  - the processes in the group are going to be run in parallel
-      //  - each rank is assigned ONE atm process
-      //  - all the atm processes not assigned to this rank will be filled with
-      //    an instance of "RemoteProcessStub" (to be implemented),
-      //    which is a do-nothing class, only responsible to keep track of dependencies
-      //  - the input parameter list should specify for each atm process the number
-      //    of mpi ranks dedicated to it. Obviously, these numbers should add up
-      //    to the size of the input communicator.
-      //  - this class is then responsible of 'combining' the results togehter,
-      //    including remapping input/output fields to/from the sub-comm
-      //    distribution.
-      EKAT_ERROR_MSG("Error! Parallel schedule type not yet implemented.\n");
-    }
 
     // Get the params of this atm proc
     auto& params_i = m_params.sublist(ap_name);
@@ -447,6 +435,68 @@ void AtmosphereProcessGroup::initialize_impl (const RunType run_type) {
     m_atm_logger->debug("[EAMxx::initialize::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
   }
+
+  if (m_group_schedule_type==ScheduleType::Parallel) {
+    setup_parallel_splitting();
+  }
+}
+
+void AtmosphereProcessGroup::setup_parallel_splitting () {
+  // Gather, for each field, the procs that compute it and the procs that use it.
+  // NOTE: we key fields by their id string, since the same field may be on multiple grids.
+  //       For groups, we look at the individual fields, since procs in the group may
+  //       compute a field both as part of a group and as a standalone field.
+  strmap_t<Field>         fields;
+  strmap_t<std::set<int>> computed_by;
+  strmap_t<std::set<int>> used_by;
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    const auto& ap = m_atm_processes[iproc];
+    auto add_computed = [&](const Field& f) {
+      const auto& id = f.get_header().get_identifier().get_id_string();
+      fields.emplace(id,f);
+      computed_by[id].insert(iproc);
+      used_by[id].insert(iproc);
+    };
+    for (const auto& f : ap->get_fields_out()) {
+      add_computed(f);
+    }
+    for (const auto& g : ap->get_groups_out()) {
+      for (const auto& it : g.m_individual_fields) {
+        add_computed(*it.second);
+      }
+    }
+    for (const auto& f : ap->get_fields_in()) {
+      used_by[f.get_header().get_identifier().get_id_string()].insert(iproc);
+    }
+    for (const auto& g : ap->get_groups_in()) {
+      for (const auto& it : g.m_individual_fields) {
+        used_by[it.second->get_header().get_identifier().get_id_string()].insert(iproc);
+      }
+    }
+  }
+
+  // A field computed by a proc and not used by anyone else needs no special treatment
+  m_ps_computed_idx.resize(m_group_size);
+  for (const auto& it : computed_by) {
+    const auto& id = it.first;
+    if (used_by.at(id).size()<2) {
+      continue;
+    }
+
+    const auto& f = fields.at(id);
+    EKAT_REQUIRE_MSG (f.data_type()==DataType::RealType,
+        "Error! Parallel splitting is only supported for real-valued fields.\n"
+        " - atm proc group: " + name() + "\n"
+        " - field id: " + id + "\n");
+
+    const int idx = m_ps_fields.size();
+    m_ps_fields.push_back(f);
+    m_ps_fields_beg.push_back(f.clone(f.name()+"_"+name()+"_beg"));
+    m_ps_fields_tend.push_back(f.clone(f.name()+"_"+name()+"_tend"));
+    for (int iproc : it.second) {
+      m_ps_computed_idx[iproc].push_back(idx);
+    }
+  }
 }
 
 void AtmosphereProcessGroup::run_impl (const double dt) {
@@ -480,8 +530,47 @@ void AtmosphereProcessGroup::run_sequential (const double dt) {
   }
 }
 
-void AtmosphereProcessGroup::run_parallel (const double /* dt */) {
-  EKAT_REQUIRE_MSG (false,"Error! Parallel splitting not yet implemented.\n");
+void AtmosphereProcessGroup::run_parallel (const double dt) {
+  // Save the state at the beginning of the step, and reset the tendencies
+  const int nfields = m_ps_fields.size();
+  for (int i=0; i<nfields; ++i) {
+    m_ps_fields_beg[i].deep_copy(m_ps_fields[i]);
+    m_ps_fields_tend[i].deep_copy(Real(0));
+  }
+
+  // The stored atm procs should update the timestamp if both
+  //  - this is the last subcycle iteration
+  //  - nobody from outside told this APG to not update timestamps
+  const bool do_update = do_update_time_stamp() &&
+                      (get_subcycle_iter()==get_num_subcycles()-1);
+  for (int iproc=0; iproc<m_group_size; ++iproc) {
+    auto atm_proc = m_atm_processes[iproc];
+    atm_proc->set_update_time_stamps(do_update);
+    // Run the process
+    atm_proc->run(dt);
+
+    // Accumulate the tendency of this process, then restore the beginning-of-step
+    // state, so that the next process sees the same input as this one.
+    for (int i : m_ps_computed_idx[iproc]) {
+      auto& f = m_ps_fields[i];
+      const auto& f_beg = m_ps_fields_beg[i];
+      auto& f_tend = m_ps_fields_tend[i];
+      f_tend.update(f,Real(1),Real(1));
+      f_tend.update(f_beg,Real(-1),Real(1));
+      f.deep_copy(f_beg);
+    }
+#ifdef SCREAM_HAS_MEMORY_USAGE
+    long long my_mem_usage = get_mem_usage(MB);
+    long long max_mem_usage;
+    m_comm.all_reduce(&my_mem_usage,&max_mem_usage,1,MPI_MAX);
+    m_atm_logger->debug("[EAMxx::run_parallel::"+atm_proc->name()+"] memory usage: " + std::to_string(max_mem_usage) + "MB");
+#endif
+  }
+
+  // Sum the tendencies of all processes back into the fields
+  for (int i=0; i<nfields; ++i) {
+    m_ps_fields[i].update(m_ps_fields_tend[i],Real(1),Real(1));
+  }
 }
 
 void AtmosphereProcessGroup::finalize_impl (/* what inputs? */) {
@@ -502,6 +591,7 @@ set_required_field (const Field& f) {
     // In parallel splitting, all required fields are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_field(f);
+    return;
   }
 
   // Find the first process that requires this group
@@ -570,6 +660,7 @@ set_required_group (const FieldGroup& group) {
     // In parallel splitting, all required group are *actual* inputs,
     // and the base class impl is fine.
     AtmosphereProcess::set_required_group(group);
+    return;
   }
 
   // Find the first process that requires this group
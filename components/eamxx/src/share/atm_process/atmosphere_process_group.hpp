@@ -24,6 +24,16 @@ namespace scream
  *  The only caveat is required fields in sequential scheduling: if an atm proc
  *  requires a field that is computed by a previous atm proc in the group,
  *  that field is not exposed as a required field of the group.
+ *
+ *  In parallel scheduling (parallel splitting), all processes in the group see
+ *  the state at the beginning of the group step. For fields that are shared
+ *  among processes, each process computes a tendency (relative to the state
+ *  at the beginning of the step), and the group sums all the tendencies
+ *  back into the field once all processes have run.
+ *  NOTE: this is a numerical choice, not a performance one. The processes are
+ *        still run one after the other, on the default execution space, and the
+ *        backup/accumulation of shared fields makes it a bit more expensive than
+ *        sequential scheduling.
  */
 
 class AtmosphereProcessGroup : public AtmosphereProcess
@@ -132,6 +142,9 @@ protected:
   void run_sequential (const double dt);
   void run_parallel   (const double dt);
 
+  // Figure out which fields need to be backed up/accumulated in parallel splitting
+  void setup_parallel_splitting ();
+
   // The methods to set the fields/groups in the right processes of the group
   void set_required_field_impl (const Field& f);
   void set_computed_field_impl (const Field& f);
@@ -148,6 +161,16 @@ protected:
   // The schedule type: Parallel vs Sequential
   ScheduleType   m_group_schedule_type;
 
+  // Parallel splitting data. For each field that is computed by one process and
+  // used (required or computed) by at least another one, we store the field, a copy
+  // of its value at the beginning of the step, and the sum of the process tendencies.
+  // For each process, we also store the indices (in the vectors below) of such
+  // fields that the process computes.
+  std::vector<Field>              m_ps_fields;
+  std::vector<Field>              m_ps_fields_beg;
+  std::vector<Field>              m_ps_fields_tend;
+  std::vector<std::vector<int>>   m_ps_computed_idx;
+
   // This is only needed to be able to access grids objects later on
   std::shared_ptr<const GridsManager>   m_grids_mgr;
 };
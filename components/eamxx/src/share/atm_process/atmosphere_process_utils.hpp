@@ -35,8 +35,10 @@ inline std::string e2str (const AtmosphereProcessType ap_type) {
   return "INVALID";
 }
 
-// This enum is mostly used by AtmosphereProcessGroup to establish whether
-// its atm procs are to be run concurrently or sequentially.
+// This enum is mostly used by AtmosphereProcessGroup to establish the time
+// splitting of its atm procs: with Sequential, each proc sees the state updated
+// by the previous ones; with Parallel, all procs see the state at the beginning
+// of the step. In both cases, the procs are run one after the other.
 // We put the enum here so other files can easily access it.
 enum class ScheduleType {
   Sequential,
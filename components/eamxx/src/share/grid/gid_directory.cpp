@@ -0,0 +1,106 @@
+#include "share/grid/gid_directory.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <cstdint>
+
+namespace scream
+{
+
+GidDirectory::
+GidDirectory (const ekat::Comm& comm,
+              const gid_type* my_gids, const int num_my_gids)
+ : m_comm (comm)
+{
+  // Send each owned (gid,lid) pair to the home rank of the gid
+  std::vector<std::vector<gid_type>> sends (m_comm.size());
+  for (int lid=0; lid<num_my_gids; ++lid) {
+    auto& s = sends[home_rank(my_gids[lid])];
+    s.push_back(my_gids[lid]);
+    s.push_back(lid);
+  }
+  std::vector<int> recv_counts;
+  const auto recv = all_to_all(m_comm,sends,recv_counts);
+
+  // Pairs arrive sorted by pid, and by lid within each pid, so the first
+  // owner recorded for a gid is the lowest (pid,lid)
+  int locally_unique = 1;
+  for (int pid=0, pos=0; pid<m_comm.size(); ++pid) {
+    for (int k=0; k<recv_counts[pid]; k+=2, pos+=2) {
+      auto it = m_owners.emplace(recv[pos],Owner{pid,recv[pos+1],0}).first;
+      if (++it->second.count>1) {
+        locally_unique = 0;
+      }
+    }
+  }
+  int unique;
+  m_comm.all_reduce(&locally_unique,&unique,1,MPI_MIN);
+  m_is_unique = unique==1;
+}
+
+void GidDirectory::
+lookup (const gid_type* gids, const int num_gids,
+        std::vector<int>& pids, std::vector<int>& lids,
+        std::vector<int>* num_owners) const
+{
+  const int nranks = m_comm.size();
+
+  // Ask the home rank of each gid, remembering where the answer goes
+  std::vector<std::vector<gid_type>> queries (nranks);
+  std::vector<std::vector<int>> query_idx (nranks);
+  for (int i=0; i<num_gids; ++i) {
+    const int home = home_rank(gids[i]);
+    queries[home].push_back(gids[i]);
+    query_idx[home].push_back(i);
+  }
+  std::vector<int> recv_counts;
+  const auto asked = all_to_all(m_comm,queries,recv_counts);
+
+  // Answer with (pid,lid,count) for each gid we were asked about
+  std::vector<std::vector<int>> answers (nranks);
+  for (int pid=0, pos=0; pid<nranks; ++pid) {
+    auto& a = answers[pid];
+    a.reserve(3*recv_counts[pid]);
+    for (int k=0; k<recv_counts[pid]; ++k, ++pos) {
+      auto it = m_owners.find(asked[pos]);
+      if (it==m_owners.end()) {
+        a.insert(a.end(),{-1,-1,0});
+      } else {
+        a.insert(a.end(),{it->second.pid,it->second.lid,it->second.count});
+      }
+    }
+  }
+  const auto answered = all_to_all(m_comm,answers,recv_counts);
+
+  // Answers come back in the order of the queries
+  pids.assign(num_gids,-1);
+  lids.assign(num_gids,-1);
+  if (num_owners) {
+    num_owners->assign(num_gids,0);
+  }
+  for (int home=0, pos=0; home<nranks; ++home) {
+    for (int idx : query_idx[home]) {
+      pids[idx] = answered[pos];
+      lids[idx] = answered[pos+1];
+      if (num_owners) {
+        (*num_owners)[idx] = answered[pos+2];
+      }
+      pos += 3;
+    }
+  }
+}
+
+int GidDirectory::home_rank (const gid_type gid) const
+{
+  // Mix the bits (murmur3 finalizer), so that gids with a common stride
+  // still spread evenly across ranks
+  auto h = static_cast<std::uint32_t>(gid);
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h % static_cast<std::uint32_t>(m_comm.size());
+}
+
+} // namespace scream
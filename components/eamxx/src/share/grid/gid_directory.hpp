@@ -0,0 +1,131 @@
+#ifndef EAMXX_GID_DIRECTORY_HPP
+#define EAMXX_GID_DIRECTORY_HPP
+
+#include "share/util/eamxx_utils.hpp"  // For check_mpi_call
+
+#include <ekat/mpi/ekat_comm.hpp>
+#include <mpi.h> // We do some direct MPI calls
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A distributed directory of the owners of a set of GIDs
+ *
+ * Each rank of the comm owns a list of GIDs, with the local id (lid) of a GID
+ * being its position in the list. The directory answers the question "which
+ * rank owns this GID, and at which lid?" for any GID, on any rank.
+ *
+ * Each GID has a home rank, obtained by hashing the GID, which stores its
+ * owner(s). Building the directory sends each owned GID to its home rank, and
+ * a lookup asks the home ranks of the requested GIDs, with one MPI_Alltoallv
+ * each way. Hence, memory and traffic per rank scale with the number of local
+ * GIDs, rather than with the global number of GIDs, as they do if every rank
+ * broadcasts its GIDs in turn.
+ *
+ * Construction and lookups are collective over the comm.
+ */
+
+class GidDirectory
+{
+public:
+  // Must match AbstractGrid::gid_type
+  using gid_type = int;
+
+  GidDirectory (const ekat::Comm& comm,
+                const gid_type* my_gids, const int num_my_gids);
+  GidDirectory (const ekat::Comm& comm, const std::vector<gid_type>& my_gids)
+   : GidDirectory (comm,my_gids.data(),my_gids.size())
+  {}
+
+  // For each input GID, retrieve the owner pid, and the GID's lid on that pid.
+  // If a GID has multiple owners, the lowest pid (and, within it, the lowest lid)
+  // is returned. If a GID has no owner, pid=lid=-1.
+  // If num_owners is not null, it is filled with the number of (pid,lid) pairs
+  // owning each GID.
+  void lookup (const gid_type* gids, const int num_gids,
+               std::vector<int>& pids, std::vector<int>& lids,
+               std::vector<int>* num_owners = nullptr) const;
+  void lookup (const std::vector<gid_type>& gids,
+               std::vector<int>& pids, std::vector<int>& lids,
+               std::vector<int>* num_owners = nullptr) const {
+    lookup (gids.data(),gids.size(),pids,lids,num_owners);
+  }
+
+  // Whether each GID is owned by exactly one (pid,lid) pair across the comm
+  bool is_unique () const { return m_is_unique; }
+
+  const ekat::Comm& get_comm () const { return m_comm; }
+
+  // Rank storing the owners of a GID
+  int home_rank (const gid_type gid) const;
+
+private:
+
+  struct Owner {
+    int pid;
+    int lid;
+    int count;
+  };
+
+  ekat::Comm  m_comm;
+
+  // The owners of the GIDs whose home is this rank
+  std::unordered_map<gid_type,Owner>  m_owners;
+
+  bool m_is_unique;
+};
+
+// Personalized all-to-all exchange: send sends[pid] to each pid, and return
+// the concatenation (by ascending pid) of what each pid sent to this rank.
+// On output, recv_counts[pid] is the number of entries received from pid.
+// Collective over comm.
+template<typename T>
+std::vector<T>
+all_to_all (const ekat::Comm& comm,
+            const std::vector<std::vector<T>>& sends,
+            std::vector<int>& recv_counts)
+{
+  const int nranks = comm.size();
+  EKAT_REQUIRE_MSG (static_cast<int>(sends.size())==nranks,
+      "Error! all_to_all needs one send list per rank.\n"
+      "  - comm size: " + std::to_string(nranks) + "\n"
+      "  - num send lists: " + std::to_string(sends.size()) + "\n");
+
+  std::vector<int> send_counts(nranks), send_offsets(nranks+1,0);
+  for (int pid=0; pid<nranks; ++pid) {
+    send_counts[pid] = sends[pid].size();
+    send_offsets[pid+1] = send_offsets[pid] + send_counts[pid];
+  }
+  std::vector<T> send_buf (send_offsets[nranks]);
+  for (int pid=0; pid<nranks; ++pid) {
+    std::copy(sends[pid].begin(),sends[pid].end(),send_buf.begin()+send_offsets[pid]);
+  }
+
+  recv_counts.resize(nranks);
+  check_mpi_call(MPI_Alltoall(send_counts.data(),1,MPI_INT,
+                              recv_counts.data(),1,MPI_INT,comm.mpi_comm()),
+                 "all_to_all: MPI_Alltoall");
+
+  std::vector<int> recv_offsets(nranks+1,0);
+  for (int pid=0; pid<nranks; ++pid) {
+    recv_offsets[pid+1] = recv_offsets[pid] + recv_counts[pid];
+  }
+  std::vector<T> recv_buf (recv_offsets[nranks]);
+
+  const auto mpi_t = ekat::get_mpi_type<T>();
+  check_mpi_call(MPI_Alltoallv(send_buf.data(),send_counts.data(),send_offsets.data(),mpi_t,
+                               recv_buf.data(),recv_counts.data(),recv_offsets.data(),mpi_t,
+                               comm.mpi_comm()),
+                 "all_to_all: MPI_Alltoallv");
+  return recv_buf;
+}
+
+} // namespace scream
+
+#endif // EAMXX_GID_DIRECTORY_HPP
@@ -1,7 +1,11 @@
 #include "grid_import_export.hpp"
+#include "share/grid/gid_directory.hpp"
 
 #include "share/field/field_utils.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace scream
 {
 
@@ -19,75 +23,48 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
   m_overlapped = overlapped;
   m_comm = unique->get_comm();
 
-  // Note: we can't use the gids views from the grids, since we need to pass pointers
-  //       to MPI bcast routines, which require pointers to nonconst data.
-  //       Hence, create a clone, and grab a non-const pointer from it.
-  const auto unique_gids_f = unique->get_dofs_gids().clone();
-  const auto overlap_gids_f = overlapped->get_dofs_gids().clone();
-  const auto    gids = unique_gids_f.get_view<gid_type*,Host>();
-  const auto ov_gids = overlap_gids_f.get_view<gid_type*,Host>();
+  const auto    gids = unique->get_dofs_gids().get_view<const gid_type*,Host>();
+  const auto ov_gids = overlapped->get_dofs_gids().get_view<const gid_type*,Host>();
 
   int num_ov_gids = ov_gids.size();
 
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  std::map<int,std::vector<int>> pid2lids;
-
   // ------------------ Create import structures ----------------------- //
 
+  // Locate the owner (pid and lid) of each dst gid in the src grid
+  GidDirectory directory(m_comm,gids.data(),gids.size());
+  std::vector<int> owner_pids, owner_lids;
+  directory.lookup(ov_gids.data(),num_ov_gids,owner_pids,owner_lids);
+  const auto num_imports = std::count_if(owner_pids.begin(),owner_pids.end(),
+                                         [](const int pid) { return pid>=0; });
+  EKAT_REQUIRE_MSG (num_ov_gids==num_imports,
+      "Error! Could not locate the owner of one of the dst grid GIDs.\n"
+      "  - rank: " + std::to_string(m_comm.rank()) + "\n"
+      "  - num found: " + std::to_string(num_imports) + "\n"
+      "  - num dst gids: " + std::to_string(num_ov_gids) + "\n");
+
+  // IMPORTANT! Within each PID, we order the list of imports according to the
+  // *remote* ordering, so sort by (pid,remote lid).
+  std::vector<int> import_order(num_ov_gids);
+  std::iota(import_order.begin(),import_order.end(),0);
+  std::sort(import_order.begin(),import_order.end(),
+            [&](const int a, const int b) {
+              return owner_pids[a]<owner_pids[b] or
+                     (owner_pids[a]==owner_pids[b] and owner_lids[a]<owner_lids[b]);
+            });
+
   // Resize output
   m_import_lids = decltype(m_import_lids)("",num_ov_gids);
   m_import_pids = decltype(m_import_pids)("",num_ov_gids);
 
   m_import_lids_h = Kokkos::create_mirror_view(m_import_lids);
   m_import_pids_h = Kokkos::create_mirror_view(m_import_pids);
-  Kokkos::deep_copy(m_import_pids_h,-1);
-
-  // We may have repeated gids. In that case, we want to update
-  // the pids/lids arrays at all indices corresponding to the same gid
-  // std::map<gid_type,std::vector<int>> gid2idx;
-  // for (int i=0; i<num_ov_gids; ++i) {
-  //   gid2idx[ov_gids[i]].push_back(i);
-  // }
-  auto ov_gid2lid = overlapped->get_gid2lid_map();
-
-  // Let each rank bcast its src gids, so that other procs can
-  // check against their dst grid
-  int num_imports = 0;
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    // Bcast dst gids count for this pid
-    int num_gids_pid = gids.size();
-    m_comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==m_comm.rank()) {
-      data = gids.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    m_comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of this pid's gids in the dst gids list
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = ov_gid2lid.find(data[i]);
-      if (it!=ov_gid2lid.end()) {
-        pid2lids[pid].push_back(it->second);
-        ++num_imports;
-      }
-    }
-  }
-  EKAT_REQUIRE_MSG (num_ov_gids==num_imports,
-      "Error! Could not locate the owner of one of the dst grid GIDs.\n"
-      "  - rank: " + std::to_string(m_comm.rank()) + "\n"
-      "  - num found: " + std::to_string(num_imports) + "\n"
-      "  - num dst gids: " + std::to_string(num_ov_gids) + "\n");
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    const auto& lids = pid2lids[pid];
-    for (size_t i=0; i<lids.size(); ++i,++pos) {
-      m_import_lids_h(pos) = lids[i];
-      m_import_pids_h(pos) = pid;
-    }
+
+  std::vector<std::vector<int>> remote_lids (m_comm.size());
+  for (int pos=0; pos<num_ov_gids; ++pos) {
+    const int lid = import_order[pos];
+    m_import_lids_h(pos) = lid;
+    m_import_pids_h(pos) = owner_pids[lid];
+    remote_lids[owner_pids[lid]].push_back(owner_lids[lid]);
   }
 
   Kokkos::deep_copy(m_import_lids,m_import_lids_h);
@@ -95,53 +72,20 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
 
   // ------------------ Create export structures ----------------------- //
 
-  auto gid2lid = unique->get_gid2lid_map();
-
-  // Let each rank bcast its src gids, so that other procs can
-  // check against their dst grid
-  // Note: we don't know a priori how many PIDs will need each
-  // of our dofs, so we cannot insert in the export pids/lids views yet,
-  // and must use a temporary map to store results
-  int num_exports = 0;
-  pid2lids.clear();
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    // Bcast dst gids count for this pid
-    int num_gids_pid = ov_gids.size();
-    m_comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==m_comm.rank()) {
-      data = ov_gids.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    m_comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the src lids is in the list of needs of this pid
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2lid.find(data[i]);
-      if (it!=gid2lid.end()) {
-        pid2lids[pid].push_back(it->second);
-        ++num_exports;
-      }
-    }
-
-    // IMPORTANT! When building the import data, within each PID, we order
-    // the list of imports according to the *remote* ordering. In order for
-    // p2p messages to be consistent, the export data must order the
-    // list of exports according to the *local* ordring.
-    std::sort(pid2lids[pid].begin(),pid2lids[pid].end());
-  }
+  // Tell each owner which of its lids we import, so that it knows what to
+  // export to us. Each list arrives sorted by lid (the *local* ordering on
+  // the exporting side), which is consistent with the order of the imports.
+  std::vector<int> num_exports_per_pid;
+  const auto export_lids = all_to_all(m_comm,remote_lids,num_exports_per_pid);
+  const int num_exports = export_lids.size();
 
   m_export_pids = view_1d<int>("",num_exports);
   m_export_lids = view_1d<int>("",num_exports);
   m_export_lids_h = Kokkos::create_mirror_view(m_export_lids);
   m_export_pids_h = Kokkos::create_mirror_view(m_export_pids);
   for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    const auto& lids = pid2lids[pid];
-    for (size_t i=0; i<lids.size(); ++i,++pos) {
-      m_export_lids_h(pos) = lids[i];
+    for (int i=0; i<num_exports_per_pid[pid]; ++i,++pos) {
+      m_export_lids_h(pos) = export_lids[pos];
       m_export_pids_h(pos) = pid;
     }
   }
@@ -203,10 +203,12 @@ void CoarseningRemapper::remap_fwd_impl ()
     return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
   };
 
-  // Loop over each field
+  // Loop over each field. Recall that in these y=Ax products,
+  // x is the src field, and y is the overlapped tgt field.
+  // Masked fields are handled one at a time, while all other fields
+  // are batched together, so that the matrix is traversed only once.
+  std::vector<Field> x_batch, y_batch;
   for (int i=0; i<m_num_fields; ++i) {
-    // First, perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the src field, and y is the overlapped tgt field.
     const auto& f_src = m_src_fields[i];
     const auto& f_ov  = m_ov_fields[i];
 
@@ -222,17 +224,23 @@ void CoarseningRemapper::remap_fwd_impl ()
         local_mat_vec<1>(f_src,f_ov,mask);
       }
     } else {
-      // If possible, dispatch kernel with SCREAM_PACK_SIZE
-      if (can_pack_field(f_src) and can_pack_field(f_ov)) {
-        local_mat_vec<SCREAM_PACK_SIZE>(f_src,f_ov);
-      } else {
-        local_mat_vec<1>(f_src,f_ov);
-      }
+      x_batch.push_back(f_src);
+      y_batch.push_back(f_ov);
     }
   }
 
-  // Pack, then fire off the sends
-  pack_and_send ();
+  // Compute the ov rows that go to other ranks first, and fire off those sends.
+  // Then, while the messages are in flight, compute the ov rows that we own.
+  // Note: an empty list of rows would mean "all rows" for local_mat_vec.
+  if (x_batch.size()>0 and m_remote_ov_rows.size()>0) {
+    local_mat_vec(x_batch,y_batch,m_remote_ov_rows);
+  }
+  pack_and_send (false);
+
+  if (x_batch.size()>0 and m_self_ov_rows.size()>0) {
+    local_mat_vec(x_batch,y_batch,m_self_ov_rows);
+  }
+  pack_and_send (true);
 
   // Wait for all data to be received, then unpack
   recv_and_unpack ();
@@ -602,13 +610,13 @@ local_mat_vec (const Field& x, const Field& y, const Field& mask) const
   }
 }
 
-void CoarseningRemapper::pack_and_send ()
+void CoarseningRemapper::pack (const int beg, const int end)
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
   using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
 
-  const int num_send_gids = m_ov_coarse_grid->get_num_local_dofs();
+  const int num_send_gids = end - beg;
   const auto pid_lid_start = m_send_pid_lids_start;
   const auto lids_pids = m_send_lids_pids;
   const auto buf = m_send_buffer;
@@ -629,7 +637,7 @@ void CoarseningRemapper::pack_and_send ()
         // therefore allowing the 1d field to be a subfield of a 2d field
         // along the 2nd dimension.
         auto v = f.get_strided_view<const Real*>();
-        Kokkos::parallel_for(RangePolicy(0,num_send_gids),
+        Kokkos::parallel_for(RangePolicy(beg,end),
                              KOKKOS_LAMBDA(const int& i){
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
@@ -646,7 +654,7 @@ void CoarseningRemapper::pack_and_send ()
         auto policy = ESU::get_default_team_policy(num_send_gids,dim1);
         Kokkos::parallel_for(policy,
                              KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
+          const int i = beg + team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
           const int lidpos = i - pid_lid_start(pid);
@@ -666,7 +674,7 @@ void CoarseningRemapper::pack_and_send ()
         auto policy = ESU::get_default_team_policy(num_send_gids,dim1*dim2);
         Kokkos::parallel_for(policy,
                              KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
+          const int i = beg + team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
           const int lidpos = i - pid_lid_start(pid);
@@ -689,7 +697,7 @@ void CoarseningRemapper::pack_and_send ()
         auto policy = ESU::get_default_team_policy(num_send_gids,dim1*dim2*dim3);
         Kokkos::parallel_for(policy,
                              KOKKOS_LAMBDA(const MemberType& team){
-          const int i = team.league_rank();
+          const int i = beg + team.league_rank();
           const int lid = lids_pids(i,0);
           const int pid = lids_pids(i,1);
           const int lidpos = i - pid_lid_start(pid);
@@ -713,19 +721,56 @@ void CoarseningRemapper::pack_and_send ()
     }
   }
 
+}
+
+void CoarseningRemapper::pack_and_send (const bool self)
+{
+  // Pack the data for the requested pids. The lids to send to each pid are
+  // contiguous, and so are the chunks of the send buffer for each pid.
+  // Recall that the requests are sorted by pid as well.
+  const int me = m_comm.rank();
+  const int nranks = m_comm.size();
+  std::vector<std::pair<int,int>> pid_ranges;
+  if (self) {
+    pid_ranges.emplace_back(me,me+1);
+  } else {
+    pid_ranges.emplace_back(0,me);
+    pid_ranges.emplace_back(me+1,nranks);
+  }
+
+  for (const auto& pr : pid_ranges) {
+    const int lids_beg = m_send_pid_lids_offsets[pr.first];
+    const int lids_end = m_send_pid_lids_offsets[pr.second];
+    if (lids_end>lids_beg) {
+      pack (lids_beg,lids_end);
+    }
+  }
+
   // Ensure all threads are done packing before firing off the sends
   Kokkos::fence();
 
-  // If MPI does not use dev pointers, we need to deep copy from dev to host
-  if (not MpiOnDev) {
-    Kokkos::deep_copy (m_mpi_send_buffer,m_send_buffer);
-  }
+  for (const auto& pr : pid_ranges) {
+    const int buf_beg = m_send_pid_buf_offsets[pr.first];
+    const int buf_end = m_send_pid_buf_offsets[pr.second];
+    if (buf_end==buf_beg) {
+      continue;
+    }
 
-  if (not m_send_req.empty()) {
-    int ierr = MPI_Startall(m_send_req.size(),m_send_req.data());
-    EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
-        "Error! Something whent wrong while starting persistent send requests.\n"
-        "  - send rank: " + std::to_string(m_comm.rank()) + "\n");
+    // If MPI does not use dev pointers, we need to deep copy from dev to host
+    if (not MpiOnDev) {
+      auto range = Kokkos::make_pair(buf_beg,buf_end);
+      Kokkos::deep_copy (Kokkos::subview(m_mpi_send_buffer,range),
+                         Kokkos::subview(m_send_buffer,range));
+    }
+
+    const int req_beg = m_send_pid_req_offsets[pr.first];
+    const int req_end = m_send_pid_req_offsets[pr.second];
+    if (req_end>req_beg) {
+      int ierr = MPI_Startall(req_end-req_beg,m_send_req.data()+req_beg);
+      EKAT_REQUIRE_MSG (ierr==MPI_SUCCESS,
+          "Error! Something whent wrong while starting persistent send requests.\n"
+          "  - send rank: " + std::to_string(m_comm.rank()) + "\n");
+    }
   }
 }
 
@@ -1006,6 +1051,32 @@ void CoarseningRemapper::setup_mpi_data_structures ()
   Kokkos::deep_copy(m_send_lids_pids,send_lids_pids_h);
   Kokkos::deep_copy(m_send_pid_lids_start,send_pid_lids_start_h);
 
+  // Host copy of the above (with the end), and split the ov rows in those that
+  // we send to ourselves, and those that we send to other ranks. This allows
+  // to overlap the computation of the former with the communication of the latter.
+  const int me = m_comm.rank();
+  m_send_pid_lids_offsets.resize(m_comm.size()+1);
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    m_send_pid_lids_offsets[pid] = send_pid_lids_start_h(pid);
+  }
+  m_send_pid_lids_offsets[m_comm.size()] = num_ov_gids;
+
+  const int self_beg = m_send_pid_lids_offsets[me];
+  const int self_end = m_send_pid_lids_offsets[me+1];
+  m_self_ov_rows   = view_1d<int>("",self_end-self_beg);
+  m_remote_ov_rows = view_1d<int>("",num_ov_gids-(self_end-self_beg));
+  auto self_ov_rows_h   = Kokkos::create_mirror_view(m_self_ov_rows);
+  auto remote_ov_rows_h = Kokkos::create_mirror_view(m_remote_ov_rows);
+  for (int i=0,iremote=0; i<num_ov_gids; ++i) {
+    if (i>=self_beg and i<self_end) {
+      self_ov_rows_h(i-self_beg) = send_lids_pids_h(i,0);
+    } else {
+      remote_ov_rows_h(iremote++) = send_lids_pids_h(i,0);
+    }
+  }
+  Kokkos::deep_copy(m_self_ov_rows,self_ov_rows_h);
+  Kokkos::deep_copy(m_remote_ov_rows,remote_ov_rows_h);
+
   // 3. Compute offsets in send buffer for each pid/field pair
   m_send_f_pid_offsets = view_2d<int>("",m_num_fields,m_comm.size());
   auto send_f_pid_offsets_h = Kokkos::create_mirror_view(m_send_f_pid_offsets);
@@ -1024,6 +1095,8 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     }
   }
   Kokkos::deep_copy (m_send_f_pid_offsets,send_f_pid_offsets_h);
+  m_send_pid_buf_offsets = send_pid_offsets;
+  m_send_pid_buf_offsets.push_back(num_ov_gids*sum_fields_col_sizes);
 
   // 4. Allocate send buffers
   m_send_buffer = view_1d<Real>("",sum_fields_col_sizes*num_ov_gids);
@@ -1031,6 +1104,7 @@ void CoarseningRemapper::setup_mpi_data_structures ()
 
   // 5. Setup send requests
   m_send_req.reserve(num_send_pids);
+  std::vector<int> send_req_pids;
   for (const auto& it : pid2lids_send) {
     const int n = it.second.size()*sum_fields_col_sizes;
     if (n==0) {
@@ -1044,6 +1118,14 @@ void CoarseningRemapper::setup_mpi_data_structures ()
     auto& req = m_send_req.back();
     MPI_Send_init (send_ptr, n, mpi_real, pid,
                    0, mpi_comm, &req);
+    send_req_pids.push_back(pid);
+  }
+
+  // Offset of the requests for each pid (requests are sorted by pid)
+  m_send_pid_req_offsets.resize(m_comm.size()+1);
+  for (int pid=0; pid<=m_comm.size(); ++pid) {
+    auto it = std::lower_bound(send_req_pids.begin(),send_req_pids.end(),pid);
+    m_send_pid_req_offsets[pid] = std::distance(send_req_pids.begin(),it);
   }
 
   // --------------------------------------------------------- //
@@ -1159,6 +1241,11 @@ void CoarseningRemapper::clean_up ()
   m_recv_lids_pidpos    = view_2d<int>();
   m_recv_lids_beg       = view_1d<int>();
   m_recv_lids_end       = view_1d<int>();
+  m_self_ov_rows        = view_1d<int>();
+  m_remote_ov_rows      = view_1d<int>();
+  m_send_pid_lids_offsets.clear();
+  m_send_pid_buf_offsets.clear();
+  m_send_pid_req_offsets.clear();
   m_send_req.clear();
   m_recv_req.clear();
 
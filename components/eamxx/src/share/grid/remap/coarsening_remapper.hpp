@@ -77,7 +77,8 @@ public:
   void local_mat_vec (const Field& f_src, const Field& f_tgt, const Field& mask) const;
   template<int N>
   void rescale_masked_fields (const Field& f_tgt, const Field& f_mask) const;
-  void pack_and_send ();
+  void pack (const int beg, const int end);
+  void pack_and_send (const bool self);
   void recv_and_unpack ();
   // Overload, not hide
   using HorizInterpRemapperBase::local_mat_vec;
@@ -125,6 +126,18 @@ protected:
   // Store the start of lids to send to each PID in the view above
   view_1d<int>          m_send_pid_lids_start;
 
+  // Host copies of the start of each PID lids, data in the send buffer, and
+  // send requests (with the end appended), so we can send to subsets of PIDs
+  std::vector<int>      m_send_pid_lids_offsets;
+  std::vector<int>      m_send_pid_buf_offsets;
+  std::vector<int>      m_send_pid_req_offsets;
+
+  // The ov rows that we send to ourselves, and those that we send to other PIDs.
+  // The latter are computed first, so we can compute the former while their
+  // messages are in flight.
+  view_1d<int>          m_self_ov_rows;
+  view_1d<int>          m_remote_ov_rows;
+
   // Unlike the packing for sends, unpacking after the recv can cause
   // race conditions. Hence, we ||ize of tgt lids, and process separate
   // contributions from separate PIDs serially. To do so, we use the
@@ -7,10 +7,46 @@
 #include <ekat/kokkos/ekat_kokkos_utils.hpp>
 #include <ekat/ekat_pack_utils.hpp>
 #include <numeric>
+#include <algorithm>
 
 namespace scream
 {
 
+namespace {
+
+// Get data pointer and col stride (in units of ST) of a field, seen as a 2d
+// array (col,vals), as well as the number of vals. Returns false if the
+// entries past the COL dimension are not contiguous in memory.
+template<typename ST>
+bool get_mat_vec_data (const Field& f, ST*& data, int& col_stride, int& nvals)
+{
+  using RT = std::conditional_t<std::is_const<ST>::value,const Real,Real>;
+
+  bool contiguous = true;
+  auto set_data = [&](const auto& v) {
+    data = reinterpret_cast<ST*>(v.data());
+    col_stride = v.stride(0);
+    nvals = 1;
+    for (int d=int(v.rank)-1; d>0; --d) {
+      contiguous &= v.stride(d)==static_cast<size_t>(nvals);
+      nvals *= v.extent(d);
+    }
+  };
+
+  switch (f.get_header().get_identifier().get_layout().rank()) {
+    // For rank-1 fields, use strided view, to allow subfields along the 2nd dim
+    case 1: set_data(f.get_strided_view<RT*>()); break;
+    case 2: set_data(f.get_view<ST**>());        break;
+    case 3: set_data(f.get_view<ST***>());       break;
+    case 4: set_data(f.get_view<ST****>());      break;
+    default:
+      EKAT_ERROR_MSG("[get_mat_vec_data] Error! Fields of rank 5 or greater are not supported.\n");
+  }
+  return contiguous;
+}
+
+} // anonymous namespace
+
 HorizInterpRemapperBase::
 HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
                          const std::string& map_file,
@@ -103,6 +139,9 @@ void HorizInterpRemapperBase::registration_ends_impl ()
 
   create_ov_fields ();
   setup_mpi_data_structures ();
+
+  m_mat_vec_table   = view_1d<MatVecEntry>("mat_vec_table",m_num_fields);
+  m_mat_vec_table_h = Kokkos::create_mirror_view(m_mat_vec_table);
 }
 
 void HorizInterpRemapperBase::create_ov_fields ()
@@ -128,7 +167,8 @@ void HorizInterpRemapperBase::create_ov_fields ()
 
 template<int PackSize>
 void HorizInterpRemapperBase::
-local_mat_vec (const Field& x, const Field& y) const
+local_mat_vec (const Field& x, const Field& y,
+               const view_1d<const int>& rows) const
 {
   using RangePolicy = typename KT::RangePolicy;
   using MemberType  = typename KT::MemberType;
@@ -137,7 +177,8 @@ local_mat_vec (const Field& x, const Field& y) const
   using PackInfo    = ekat::PackInfo<PackSize>;
 
   const auto row_grid = m_type==InterpType::Refine ? m_fine_grid : m_ov_coarse_grid;
-  const int  nrows    = row_grid->get_num_local_dofs();
+  const bool all_rows = rows.size()==0;
+  const int  nrows    = all_rows ? row_grid->get_num_local_dofs() : rows.size();
 
   const auto& src_layout = x.get_header().get_identifier().get_layout();
   const int   rank       = src_layout.rank();
@@ -158,7 +199,8 @@ local_mat_vec (const Field& x, const Field& y) const
       auto x_view = x.get_strided_view<const Real*>();
       auto y_view = y.get_strided_view<      Real*>();
       Kokkos::parallel_for(RangePolicy(0,nrows),
-                           KOKKOS_LAMBDA(const int& row) {
+                           KOKKOS_LAMBDA(const int& i) {
+        const auto row = all_rows ? i : rows(i);
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
         y_view(row) = weights(beg)*x_view(col_lids(beg));
@@ -176,7 +218,7 @@ local_mat_vec (const Field& x, const Field& y) const
       auto policy = ESU::get_default_team_policy(nrows,dim1);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = all_rows ? team.league_rank() : rows(team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -199,7 +241,7 @@ local_mat_vec (const Field& x, const Field& y) const
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = all_rows ? team.league_rank() : rows(team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -225,7 +267,7 @@ local_mat_vec (const Field& x, const Field& y) const
       auto policy = ESU::get_default_team_policy(nrows,dim1*dim2*dim3);
       Kokkos::parallel_for(policy,
                            KOKKOS_LAMBDA(const MemberType& team) {
-        const auto row = team.league_rank();
+        const auto row = all_rows ? team.league_rank() : rows(team.league_rank());
 
         const auto beg = row_offsets(row);
         const auto end = row_offsets(row+1);
@@ -244,9 +286,114 @@ local_mat_vec (const Field& x, const Field& y) const
     }
     default:
     {
-      EKAT_ERROR_MSG("[HorizInterpRemapperBase::local_mat_vec] Error! Fields of rank 4 or greater are not supported.\n");
+      EKAT_ERROR_MSG("[get_mat_vec_data] Error! Fields of rank 5 or greater are not supported.\n");
+    }
+  }
+}
+
+void HorizInterpRemapperBase::
+local_mat_vec (const std::vector<Field>& x, const std::vector<Field>& y,
+               const view_1d<const int>& rows) const
+{
+  EKAT_REQUIRE_MSG (x.size()==y.size(),
+      "[HorizInterpRemapperBase::local_mat_vec] Error! Input lists have different sizes.\n");
+
+  // Helper function, to establish if a field can be handled with packs
+  auto can_pack_field = [](const Field& f) {
+    const auto& ap = f.get_header().get_alloc_properties();
+    return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
+  };
+
+  // Split the fields depending on whether we can use SCREAM_PACK_SIZE or not.
+  // Note: rank-1 fields are always handled with scalars.
+  std::vector<Field> x_pack, y_pack, x_nopack, y_nopack;
+  for (size_t i=0; i<x.size(); ++i) {
+    const auto rank = x[i].get_header().get_identifier().get_layout().rank();
+    if (rank>1 and can_pack_field(x[i]) and can_pack_field(y[i])) {
+      x_pack.push_back(x[i]);
+      y_pack.push_back(y[i]);
+    } else {
+      x_nopack.push_back(x[i]);
+      y_nopack.push_back(y[i]);
     }
   }
+
+  if (x_pack.size()>0) {
+    batched_local_mat_vec<SCREAM_PACK_SIZE>(x_pack,y_pack,rows);
+  }
+  if (x_nopack.size()>0) {
+    batched_local_mat_vec<1>(x_nopack,y_nopack,rows);
+  }
+}
+
+template<int PackSize>
+void HorizInterpRemapperBase::
+batched_local_mat_vec (const std::vector<Field>& x, const std::vector<Field>& y,
+                       const view_1d<const int>& rows) const
+{
+  using MemberType  = typename KT::MemberType;
+  using ESU         = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  using Pack        = ekat::Pack<Real,PackSize>;
+
+  const auto row_grid = m_type==InterpType::Refine ? m_fine_grid : m_ov_coarse_grid;
+  const bool all_rows = rows.size()==0;
+  const int  nrows    = all_rows ? row_grid->get_num_local_dofs() : rows.size();
+
+  // Fill the table of fields. Fields whose entries are not contiguous
+  // past the COL dimension are handled one at a time.
+  int nfields = 0;
+  int max_vals = 0;
+  for (size_t i=0; i<x.size(); ++i) {
+    const Pack* x_data;
+    Pack* y_data;
+    int x_col_stride, y_col_stride, nvals;
+    bool ok = get_mat_vec_data(x[i],x_data,x_col_stride,nvals);
+    ok &= get_mat_vec_data(y[i],y_data,y_col_stride,nvals);
+    if (not ok) {
+      local_mat_vec<PackSize>(x[i],y[i],rows);
+      continue;
+    }
+    auto& e = m_mat_vec_table_h(nfields++);
+    e.x = reinterpret_cast<const Real*>(x_data);
+    e.y = reinterpret_cast<Real*>(y_data);
+    e.x_col_stride = x_col_stride;
+    e.y_col_stride = y_col_stride;
+    e.nvals = nvals;
+    max_vals = std::max(max_vals,nvals);
+  }
+  if (nfields==0) {
+    return;
+  }
+  Kokkos::deep_copy(m_mat_vec_table,m_mat_vec_table_h);
+
+  auto row_offsets = m_row_offsets;
+  auto col_lids    = m_col_lids;
+  auto weights     = m_weights;
+  auto table       = m_mat_vec_table;
+
+  // Note: handle 1st contribution to each row separately, using = instead of +=.
+  //       This allows to avoid doing an extra loop to zero out y before the mat-vec.
+  auto policy = ESU::get_default_team_policy(nrows,max_vals);
+  Kokkos::parallel_for(policy,
+                       KOKKOS_LAMBDA(const MemberType& team) {
+    const auto row = all_rows ? team.league_rank() : rows(team.league_rank());
+
+    const auto beg = row_offsets(row);
+    const auto end = row_offsets(row+1);
+    for (int ifield=0; ifield<nfields; ++ifield) {
+      const auto& e = table(ifield);
+      auto x_data = reinterpret_cast<const Pack*>(e.x);
+      auto y_data = reinterpret_cast<Pack*>(e.y);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,e.nvals),
+                          [&](const int j){
+        auto& y_val = y_data[row*e.y_col_stride+j];
+        y_val = weights(beg)*x_data[col_lids(beg)*e.x_col_stride+j];
+        for (int icol=beg+1; icol<end; ++icol) {
+          y_val += weights(icol)*x_data[col_lids(icol)*e.x_col_stride+j];
+        }
+      });
+    }
+  });
 }
 
 void HorizInterpRemapperBase::clean_up ()
@@ -266,12 +413,12 @@ std::map<std::string,HorizRemapperData> HorizInterpRemapperBase::s_remapper_data
 // ETI, so derived classes can call this method
 template
 void HorizInterpRemapperBase::
-local_mat_vec<1>(const Field&, const Field&) const;
+local_mat_vec<1>(const Field&, const Field&, const view_1d<const int>&) const;
 
 #if SCREAM_PACK_SIZE>1
 template
 void HorizInterpRemapperBase::
-local_mat_vec<SCREAM_PACK_SIZE>(const Field&, const Field&) const;
+local_mat_vec<SCREAM_PACK_SIZE>(const Field&, const Field&, const view_1d<const int>&) const;
 #endif
 
 } // namespace scream
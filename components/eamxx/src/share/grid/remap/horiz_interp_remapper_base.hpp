@@ -44,8 +44,20 @@ protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
+  // If rows is not empty, only those rows of f_tgt are computed
   template<int N>
-  void local_mat_vec (const Field& f_src, const Field& f_tgt) const;
+  void local_mat_vec (const Field& f_src, const Field& f_tgt,
+                      const view_1d<const int>& rows = {}) const;
+
+  // Perform y=Ax for all the input fields, walking the CRS matrix once per batch
+  // of fields with compatible packing (rather than once per field).
+  // If rows is not empty, only those rows of y are computed (this allows
+  // derived classes to overlap part of the computation with MPI communication)
+  void local_mat_vec (const std::vector<Field>& x, const std::vector<Field>& y,
+                      const view_1d<const int>& rows = {}) const;
+  template<int N>
+  void batched_local_mat_vec (const std::vector<Field>& x, const std::vector<Field>& y,
+                              const view_1d<const int>& rows) const;
 
   // The fine and coarse grids. Depending on m_type, they could be
   // respectively m_src_grid and m_tgt_grid or viceversa
@@ -68,6 +80,18 @@ public:
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
 
+  // Table of fields for batched_local_mat_vec. Each field is seen as a 2d
+  // array (col,vals), with vals contiguous. Strides/sizes are in packs
+  struct MatVecEntry {
+    const Real* x;
+    Real*       y;
+    int         x_col_stride;
+    int         y_col_stride;
+    int         nvals;
+  };
+  view_1d<MatVecEntry>                      m_mat_vec_table;
+  typename view_1d<MatVecEntry>::HostMirror m_mat_vec_table_h;
+
   // Keep track of this, since we need to tell the remap data repo
   // we are releasing the data for our map file.
   std::string     m_map_file;
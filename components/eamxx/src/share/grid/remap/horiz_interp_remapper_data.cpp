@@ -4,10 +4,62 @@
 #include "share/grid/grid_import_export.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <numeric>
 
 namespace scream {
 
+namespace {
+
+// 64-bit FNV-1a hash, used to build the cache keys
+std::uint64_t fnv1a (const void* data, const std::size_t nbytes,
+                     std::uint64_t h = 14695981039346656037ULL)
+{
+  auto bytes = reinterpret_cast<const unsigned char*>(data);
+  for (std::size_t i=0; i<nbytes; ++i) {
+    h ^= bytes[i];
+    h *= 1099511628211ULL;
+  }
+  return h;
+}
+
+// Bump this if the layout of the cache files changes
+constexpr int cache_version = 1;
+constexpr std::uint64_t cache_magic = 0x4541'4d58'5852'4d50ULL; // "EAMXXRMP"
+
+// Header of the cache files. It is followed by the arrays
+//   ov_gids[num_ov_gids], gids[num_gids], row_offsets[num_rows+1], col_lids[nnz], weights[nnz]
+// each padded to a multiple of 8 bytes, so that all arrays are properly aligned.
+struct CacheHeader {
+  std::uint64_t magic;
+  std::uint64_t key;
+  std::uint64_t fine_gids_hash;
+  int version;
+  int gid_size;
+  int real_size;
+  int num_ov_gids;
+  int num_gids;
+  int num_rows;
+  int nnz;
+  int pad;
+};
+
+std::size_t padded_bytes (const std::size_t nbytes) {
+  return 8*((nbytes+7)/8);
+}
+
+} // anonymous namespace
+
+std::string HorizRemapperData::s_cache_dir = "";
+int HorizRemapperData::s_num_cache_hits = 0;
+
 // --------------- HorizRemapperData ---------------- //
 
 void HorizRemapperData::
@@ -20,6 +72,16 @@ build (const std::string& map_file,
   fine_grid = fine_grid_in;
   type = type_in;
 
+  // If the data was already built (and cached) in a previous run, just load it
+  std::string cache_file;
+  if (s_cache_dir!="") {
+    cache_file = get_cache_file (map_file);
+    if (cache_file!="" and load_from_cache (cache_file)) {
+      ++s_num_cache_hits;
+      return;
+    }
+  }
+
   // Gather sparse matrix triplets needed by this rank
   auto my_triplets = get_my_triplets (map_file);
 
@@ -28,6 +90,179 @@ build (const std::string& map_file,
 
   // Create crs matrix
   create_crs_matrix_structures (my_triplets);
+
+  if (cache_file!="") {
+    store_to_cache (cache_file);
+  }
+}
+
+std::string HorizRemapperData::
+get_cache_file (const std::string& map_file) const
+{
+  // Rank 0 hashes the map file metadata and its first MiB, and broadcasts the key.
+  // We don't hash the whole file, since that would defeat the purpose for large maps.
+  // A key of 0 means that the map file cannot be hashed (e.g., not a local path).
+  std::uint64_t key = 0;
+  if (comm.am_i_root()) {
+    struct stat st;
+    std::ifstream ifs (map_file, std::ios::binary);
+    if (stat(map_file.c_str(),&st)==0 and ifs.good()) {
+      std::vector<char> buf (std::min<std::size_t>(st.st_size,1<<20));
+      ifs.read(buf.data(),buf.size());
+      const long long fsize = st.st_size;
+      const long long mtime = st.st_mtime;
+      const int nranks = comm.size();
+      const int itype = static_cast<int>(type);
+      const int ncols_fine = fine_grid->get_num_global_dofs();
+      key = fnv1a(map_file.data(),map_file.size());
+      key = fnv1a(&fsize,sizeof(fsize),key);
+      key = fnv1a(&mtime,sizeof(mtime),key);
+      key = fnv1a(buf.data(),ifs.gcount(),key);
+      key = fnv1a(&nranks,sizeof(nranks),key);
+      key = fnv1a(&itype,sizeof(itype),key);
+      key = fnv1a(&ncols_fine,sizeof(ncols_fine),key);
+      key += key==0; // Make sure a valid key is never 0
+    }
+  }
+  MPI_Bcast(&key,1,MPI_UINT64_T,0,comm.mpi_comm());
+  if (key==0) {
+    return "";
+  }
+
+  char key_str[17];
+  std::snprintf(key_str,sizeof(key_str),"%016llx",static_cast<unsigned long long>(key));
+  return s_cache_dir + "/horiz_remap_" + key_str + ".rank" + std::to_string(comm.rank()) + ".bin";
+}
+
+std::uint64_t HorizRemapperData::
+get_fine_gids_hash () const
+{
+  auto gids_h = fine_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  return fnv1a(gids_h.data(),gids_h.size()*sizeof(gid_type));
+}
+
+bool HorizRemapperData::
+load_from_cache (const std::string& cache_file)
+{
+  // Each rank maps its own file, and checks it is compatible with the current run.
+  // Note: the key is encoded in the file name, but we check it anyways.
+  bool valid = false;
+  void* ptr = MAP_FAILED;
+  std::size_t len = 0;
+  CacheHeader h;
+  int fd = open(cache_file.c_str(),O_RDONLY);
+  if (fd>=0) {
+    struct stat st;
+    if (fstat(fd,&st)==0 and static_cast<std::size_t>(st.st_size)>=sizeof(CacheHeader)) {
+      len = st.st_size;
+      ptr = mmap(nullptr,len,PROT_READ,MAP_PRIVATE,fd,0);
+    }
+    close(fd);
+  }
+  if (ptr!=MAP_FAILED) {
+    std::memcpy(&h,ptr,sizeof(CacheHeader));
+    const auto expected_len = sizeof(CacheHeader)
+                            + padded_bytes(h.num_ov_gids*sizeof(gid_type))
+                            + padded_bytes(h.num_gids*sizeof(gid_type))
+                            + padded_bytes((h.num_rows+1)*sizeof(int))
+                            + padded_bytes(h.nnz*sizeof(int))
+                            + padded_bytes(h.nnz*sizeof(Real));
+    const int num_rows = type==InterpType::Refine ? fine_grid->get_num_local_dofs() : h.num_ov_gids;
+    valid = h.magic==cache_magic and h.version==cache_version and
+            h.gid_size==sizeof(gid_type) and h.real_size==sizeof(Real) and
+            h.num_rows==num_rows and h.fine_gids_hash==get_fine_gids_hash() and
+            len==expected_len;
+  }
+
+  // All ranks must agree, since building the data from scratch is a collective operation
+  int my_hit = valid ? 1 : 0;
+  int all_hit;
+  comm.all_reduce(&my_hit,&all_hit,1,MPI_MIN);
+  if (all_hit==0) {
+    if (ptr!=MAP_FAILED) {
+      munmap(ptr,len);
+    }
+    return false;
+  }
+
+  auto data = reinterpret_cast<const char*>(ptr) + sizeof(CacheHeader);
+  auto next = [&](const std::size_t nbytes) {
+    auto curr = data;
+    data += padded_bytes(nbytes);
+    return curr;
+  };
+  auto ov_gids     = reinterpret_cast<const gid_type*>(next(h.num_ov_gids*sizeof(gid_type)));
+  auto gids        = reinterpret_cast<const gid_type*>(next(h.num_gids*sizeof(gid_type)));
+  auto row_offs    = reinterpret_cast<const int*>(next((h.num_rows+1)*sizeof(int)));
+  auto cols        = reinterpret_cast<const int*>(next(h.nnz*sizeof(int)));
+  auto wgts        = reinterpret_cast<const Real*>(next(h.nnz*sizeof(Real)));
+
+  // Create coarse/ov_coarse grids
+  ov_coarse_grid = std::make_shared<PointGrid>("ov_coarse_grid",h.num_ov_gids,0,comm);
+  auto ov_coarse_gids_h = ov_coarse_grid->get_dofs_gids().get_view<gid_type*,Host>();
+  std::copy(ov_gids,ov_gids+h.num_ov_gids,ov_coarse_gids_h.data());
+  ov_coarse_grid->get_dofs_gids().sync_to_dev();
+
+  coarse_grid = std::make_shared<PointGrid>("coarse_grid",h.num_gids,0,comm);
+  auto coarse_gids_h = coarse_grid->get_dofs_gids().get_view<gid_type*,Host>();
+  std::copy(gids,gids+h.num_gids,coarse_gids_h.data());
+  coarse_grid->get_dofs_gids().sync_to_dev();
+
+  // Create crs matrix
+  using unmanaged_t = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  row_offsets = view_1d<int>("",h.num_rows+1);
+  col_lids    = view_1d<int>("",h.nnz);
+  weights     = view_1d<Real>("",h.nnz);
+  Kokkos::deep_copy(row_offsets,Kokkos::View<const int*,Kokkos::HostSpace,unmanaged_t>(row_offs,h.num_rows+1));
+  Kokkos::deep_copy(col_lids,Kokkos::View<const int*,Kokkos::HostSpace,unmanaged_t>(cols,h.nnz));
+  Kokkos::deep_copy(weights,Kokkos::View<const Real*,Kokkos::HostSpace,unmanaged_t>(wgts,h.nnz));
+
+  munmap(ptr,len);
+  return true;
+}
+
+void HorizRemapperData::
+store_to_cache (const std::string& cache_file) const
+{
+  auto ov_gids  = ov_coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto gids     = coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto row_offs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),row_offsets);
+  auto cols     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),col_lids);
+  auto wgts     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),weights);
+
+  CacheHeader h;
+  std::memset(&h,0,sizeof(CacheHeader));
+  h.magic = cache_magic;
+  h.version = cache_version;
+  h.gid_size = sizeof(gid_type);
+  h.real_size = sizeof(Real);
+  h.fine_gids_hash = get_fine_gids_hash();
+  h.num_ov_gids = ov_gids.size();
+  h.num_gids = gids.size();
+  h.num_rows = row_offs.size()-1;
+  h.nnz = cols.size();
+
+  // Write to a tmp file, then rename, so that a partially written file is never picked up.
+  // Failing to write the cache is not an error: we'll simply rebuild the data next time.
+  const auto tmp_file = cache_file + ".tmp" + std::to_string(getpid());
+  std::ofstream ofs (tmp_file, std::ios::binary);
+  const char zeros[8] = {0};
+  auto write = [&](const void* src, const std::size_t nbytes) {
+    ofs.write(reinterpret_cast<const char*>(src),nbytes);
+    ofs.write(zeros,padded_bytes(nbytes)-nbytes);
+  };
+  write(&h,sizeof(CacheHeader));
+  write(ov_gids.data(),ov_gids.size()*sizeof(gid_type));
+  write(gids.data(),gids.size()*sizeof(gid_type));
+  write(row_offs.data(),row_offs.size()*sizeof(int));
+  write(cols.data(),cols.size()*sizeof(int));
+  write(wgts.data(),wgts.size()*sizeof(Real));
+  ofs.close();
+  if (ofs.good()) {
+    std::rename(tmp_file.c_str(),cache_file.c_str());
+  } else {
+    std::remove(tmp_file.c_str());
+  }
 }
 
 auto HorizRemapperData::
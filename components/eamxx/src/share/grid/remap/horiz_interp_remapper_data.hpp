@@ -6,6 +6,7 @@
 
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <map>
 #include <string>
@@ -29,6 +30,16 @@ struct HorizRemapperData {
               const ekat::Comm& comm,
               const InterpType type);
 
+  // If set to a non-empty path, the (already partitioned) remap data is stored
+  // on disk (one file per rank), and subsequent builds with the same map file,
+  // fine grid decomposition, and number of ranks will mmap it, rather than
+  // reading the map file and redistributing the triplets.
+  static void set_cache_dir (const std::string& cache_dir) { s_cache_dir = cache_dir; }
+  static const std::string& get_cache_dir () { return s_cache_dir; }
+
+  // Number of builds (on this rank) that were served by the on-disk cache
+  static int get_num_cache_hits () { return s_num_cache_hits; }
+
   // The coarse grid data
   std::shared_ptr<AbstractGrid> coarse_grid;
   std::shared_ptr<AbstractGrid> ov_coarse_grid;
@@ -65,6 +76,17 @@ private:
   // Not a const ref, since we'll sort the triplets according to
   // how row gids appear in the coarse grid
   void create_crs_matrix_structures (std::vector<Triplet>& triplets);
+
+  // On-disk cache utilities. The cache key is made of a hash of the map file,
+  // the number of ranks, and the interp type. The decomposition of the fine
+  // grid is checked separately on each rank, when loading the cached data.
+  std::string get_cache_file (const std::string& map_file) const;
+  std::uint64_t get_fine_gids_hash () const;
+  bool load_from_cache (const std::string& cache_file);
+  void store_to_cache (const std::string& cache_file) const;
+
+  static std::string s_cache_dir;
+  static int         s_num_cache_hits;
 };
 
 } // namespace scream
@@ -38,17 +38,11 @@ void RefiningRemapperP2P::remap_fwd_impl ()
 
   // Do P2P communications
   pack_and_send ();
-  recv_and_unpack ();
 
-  // Perform local-mat vec
-  // Helpef function, to establish if a field can be handled with packs
-  auto can_pack_field = [](const Field& f) {
-    const auto& ap = f.get_header().get_alloc_properties();
-    return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
-  };
-
-  // Loop over each field, perform mat-vec
+  // Loop over each field, and gather the ones needing a mat-vec. These are
+  // then handled together, so that the matrix is traversed only once.
   constexpr auto COL = ShortFieldTagsNames::COL;
+  std::vector<Field> x_batch, y_batch;
   for (int i=0; i<m_num_fields; ++i) {
     auto& f_tgt = m_tgt_fields[i];
 
@@ -59,16 +53,24 @@ void RefiningRemapperP2P::remap_fwd_impl ()
       continue;
     }
 
-    // Perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the overlapped src field, and y is the tgt field.
-    const auto& f_ov = m_ov_fields[i];
+    // Recall that in these y=Ax products, x is the overlapped src field,
+    // and y is the tgt field.
+    x_batch.push_back(m_ov_fields[i]);
+    y_batch.push_back(f_tgt);
+  }
 
-    // If possible, dispatch kernel with SCREAM_PACK_SIZE
-    if (can_pack_field(f_ov) and can_pack_field(f_tgt)) {
-      local_mat_vec<SCREAM_PACK_SIZE>(f_ov,f_tgt);
-    } else {
-      local_mat_vec<1>(f_ov,f_tgt);
-    }
+  // The data we send to ourselves is likely already arrived. Unpack it, and
+  // compute the rows that only need it, while the remote data is in flight.
+  // Note: an empty list of rows would mean "all rows" for local_mat_vec.
+  recv_and_unpack (true);
+  if (x_batch.size()>0 and m_self_rows.size()>0) {
+    local_mat_vec(x_batch,y_batch,m_self_rows);
+  }
+
+  // Now wait for remote data, and compute the remaining rows
+  recv_and_unpack (false);
+  if (x_batch.size()>0 and m_remote_rows.size()>0) {
+    local_mat_vec(x_batch,y_batch,m_remote_rows);
   }
 
   // Wait for all sends to be completed
@@ -113,6 +115,32 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
                                + ncols_recv_h(pid);
   }
   Kokkos::deep_copy(m_pids_recv_offsets,pids_recv_offsets_h);
+  m_pids_recv_offsets_h = pids_recv_offsets_h;
+
+  // Split the rows in those that only need cols that we import from ourselves,
+  // and the rest. The former can be computed before remote data arrives.
+  const int me = m_comm.rank();
+  std::vector<int> ov_col_pid(ncols_recv,-1);
+  auto import_pids_h = m_imp_exp->import_pids_h();
+  auto import_lids_h = m_imp_exp->import_lids_h();
+  for (size_t i=0; i<import_pids_h.size(); ++i) {
+    ov_col_pid[import_lids_h(i)] = import_pids_h(i);
+  }
+  auto row_offsets_h = cmvdc(m_row_offsets);
+  auto col_lids_h    = cmvdc(m_col_lids);
+  const int nrows = m_fine_grid->get_num_local_dofs();
+  std::vector<int> self_rows, remote_rows;
+  for (int row=0; row<nrows; ++row) {
+    bool self = true;
+    for (int icol=row_offsets_h(row); icol<row_offsets_h(row+1); ++icol) {
+      self &= ov_col_pid[col_lids_h(icol)]==me;
+    }
+    (self ? self_rows : remote_rows).push_back(row);
+  }
+  m_self_rows   = view_1d<int>("",self_rows.size());
+  m_remote_rows = view_1d<int>("",remote_rows.size());
+  Kokkos::deep_copy(m_self_rows,view_1d<int>::HostMirror(self_rows.data(),self_rows.size()));
+  Kokkos::deep_copy(m_remote_rows,view_1d<int>::HostMirror(remote_rows.data(),remote_rows.size()));
 
   // Create the recv buffer(s)
   auto recv_buf_size = ncols_recv*total_col_size;
@@ -140,6 +168,7 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
 
   const auto mpi_comm = m_comm.mpi_comm();
   const auto mpi_real = ekat::get_mpi_type<Real>();
+  m_recv_pid_req_offsets.resize(nranks+1);
   for (int pid=0; pid<nranks; ++pid) {
     // Send request
     if (ncols_send_h(pid)>0) {
@@ -150,6 +179,7 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
                      0, mpi_comm, &req);
     }
     // Recv request
+    m_recv_pid_req_offsets[pid] = m_recv_req.size();
     if (ncols_recv_h(pid)>0) {
       auto recv_ptr = m_mpi_recv_buffer.data() + pids_recv_offsets_h(pid)*total_col_size;
       auto recv_count = ncols_recv_h(pid)*total_col_size;
@@ -158,6 +188,7 @@ void RefiningRemapperP2P::setup_mpi_data_structures ()
                      0, mpi_comm, &req);
     }
   }
+  m_recv_pid_req_offsets[nranks] = m_recv_req.size();
 }
 
 void RefiningRemapperP2P::pack_and_send ()
@@ -301,16 +332,49 @@ void RefiningRemapperP2P::pack_and_send ()
   }
 }
 
-void RefiningRemapperP2P::recv_and_unpack ()
+void RefiningRemapperP2P::recv_and_unpack (const bool self)
 {
-  if (not m_recv_req.empty()) {
-    check_mpi_call(MPI_Waitall(m_recv_req.size(),m_recv_req.data(), MPI_STATUSES_IGNORE),
-                   "[RefiningRemapperP2P] waiting on persistent recv requests.\n");
+  // Process the data from the requested pids. The imports from each pid are
+  // contiguous, and so are the chunks of the recv buffer for each pid.
+  // Recall that the requests are sorted by pid as well.
+  const int me = m_comm.rank();
+  const int nranks = m_comm.size();
+  const int total_col_size = m_fields_col_sizes_scan_sum.back();
+  std::vector<std::pair<int,int>> pid_ranges;
+  if (self) {
+    pid_ranges.emplace_back(me,me+1);
+  } else {
+    pid_ranges.emplace_back(0,me);
+    pid_ranges.emplace_back(me+1,nranks);
   }
-  // If MPI does not use dev pointers, we need to deep copy from host to dev
-  if (not MpiOnDev) {
-    Kokkos::deep_copy (m_recv_buffer,m_mpi_recv_buffer);
+
+  for (const auto& pr : pid_ranges) {
+    const int req_beg = m_recv_pid_req_offsets[pr.first];
+    const int req_end = m_recv_pid_req_offsets[pr.second];
+    if (req_end>req_beg) {
+      check_mpi_call(MPI_Waitall(req_end-req_beg,m_recv_req.data()+req_beg, MPI_STATUSES_IGNORE),
+                     "[RefiningRemapperP2P] waiting on persistent recv requests.\n");
+    }
+
+    const int imp_beg = m_pids_recv_offsets_h(pr.first);
+    const int imp_end = m_pids_recv_offsets_h(pr.second);
+    if (imp_end==imp_beg) {
+      continue;
+    }
+
+    // If MPI does not use dev pointers, we need to deep copy from host to dev
+    if (not MpiOnDev) {
+      auto range = Kokkos::make_pair(imp_beg*total_col_size,imp_end*total_col_size);
+      Kokkos::deep_copy (Kokkos::subview(m_recv_buffer,range),
+                         Kokkos::subview(m_mpi_recv_buffer,range));
+    }
+
+    unpack (imp_beg,imp_end);
   }
+}
+
+void RefiningRemapperP2P::unpack (const int beg, const int end)
+{
 
   using RangePolicy = typename KT::RangePolicy;
   using TeamMember  = typename KT::MemberType;
@@ -323,7 +387,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
   auto ncols_recv  = m_imp_exp->num_imports_per_pid();
   auto pids_recv_offsets = m_pids_recv_offsets;
   auto recv_buf = m_recv_buffer;
-  const int num_imports = import_pids.size();
+  const int num_imports = end - beg;
   const int total_col_size = m_fields_col_sizes_scan_sum.back();
   for (int ifield=0; ifield<m_num_fields; ++ifield) {
           auto& f  = m_ov_fields[ifield];
@@ -347,7 +411,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
                       + pos_within_pid;
           v(icol) = recv_buf(offset);
         };
-        Kokkos::parallel_for(RangePolicy(0,num_imports),unpack);
+        Kokkos::parallel_for(RangePolicy(beg,end),unpack);
         break;
       }
       case 2:
@@ -356,7 +420,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
         const int dim1 = fl.dim(1);
         auto policy = ESU::get_default_team_policy(num_imports,dim1);
         auto unpack = KOKKOS_LAMBDA (const TeamMember& team) {
-          const int idx  = team.league_rank();
+          const int idx  = beg + team.league_rank();
           const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
           const auto pid_offset = pids_recv_offsets(pid);
@@ -381,7 +445,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
         const int f_col_size = dim1*dim2;
         auto policy = ESU::get_default_team_policy(num_imports,dim1*dim2);
         auto unpack = KOKKOS_LAMBDA (const TeamMember& team) {
-          const int idx  = team.league_rank();
+          const int idx  = beg + team.league_rank();
           const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
           const auto pid_offset = pids_recv_offsets(pid);
@@ -409,7 +473,7 @@ void RefiningRemapperP2P::recv_and_unpack ()
         const int f_col_size = dim1*dim2*dim3;
         auto policy = ESU::get_default_team_policy(num_imports,dim1*dim2*dim3);
         auto unpack = KOKKOS_LAMBDA (const TeamMember& team) {
-          const int idx  = team.league_rank();
+          const int idx  = beg + team.league_rank();
           const int pid  = import_pids(idx);
           const int icol = import_lids(idx);
           const auto pid_offset = pids_recv_offsets(pid);
@@ -445,6 +509,9 @@ void RefiningRemapperP2P::clean_up ()
   m_recv_buffer         = view_1d<Real>();
   m_mpi_send_buffer     = mpi_view_1d<Real>();
   m_mpi_recv_buffer     = mpi_view_1d<Real>();
+  m_self_rows           = view_1d<int>();
+  m_remote_rows         = view_1d<int>();
+  m_recv_pid_req_offsets.clear();
   m_send_req.clear();
   m_recv_req.clear();
   m_imp_exp = nullptr;
@@ -70,7 +70,8 @@ protected:
 public:
 #endif
   void pack_and_send ();
-  void recv_and_unpack ();
+  void recv_and_unpack (const bool self);
+  void unpack (const int beg, const int end);
 
 protected:
 
@@ -103,6 +104,15 @@ protected:
   // Offset of each pid in send/recv buffers
   view_1d<int>  m_pids_send_offsets;
   view_1d<int>  m_pids_recv_offsets;
+  view_1d<int>::HostMirror  m_pids_recv_offsets_h;
+
+  // Start of the recv requests for each pid (with the end appended)
+  std::vector<int>  m_recv_pid_req_offsets;
+
+  // The tgt rows that only need data that we send to ourselves, and the rest.
+  // The former are computed while data from other pids is still in flight.
+  view_1d<int>  m_self_rows;
+  view_1d<int>  m_remote_rows;
 
   // For each col, its position within the set of cols
   // sent/recv to/from the corresponding remote
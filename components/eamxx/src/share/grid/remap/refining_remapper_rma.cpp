@@ -59,14 +59,10 @@ void RefiningRemapperRMA::remap_fwd_impl ()
                    "MPI_Win_complete for field: " + m_ov_fields[i].name());
   }
 
-  // Helpef function, to establish if a field can be handled with packs
-  auto can_pack_field = [](const Field& f) {
-    const auto& ap = f.get_header().get_alloc_properties();
-    return (ap.get_last_extent() % SCREAM_PACK_SIZE) == 0;
-  };
-
-  // Loop over each field, perform mat-vec
+  // Loop over each field, and gather the ones needing a mat-vec. These are
+  // then handled together, so that the matrix is traversed only once.
   constexpr auto COL = ShortFieldTagsNames::COL;
+  std::vector<Field> x_batch, y_batch;
   for (int i=0; i<m_num_fields; ++i) {
     auto& f_tgt = m_tgt_fields[i];
 
@@ -77,17 +73,12 @@ void RefiningRemapperRMA::remap_fwd_impl ()
       continue;
     }
 
-    // Perform the local mat-vec. Recall that in these y=Ax products,
-    // x is the overlapped src field, and y is the tgt field.
-    const auto& f_ov_src    = m_ov_fields[i];
-
-    // If possible, dispatch kernel with SCREAM_PACK_SIZE
-    if (can_pack_field(f_ov_src) and can_pack_field(f_tgt)) {
-      local_mat_vec<SCREAM_PACK_SIZE>(f_ov_src,f_tgt);
-    } else {
-      local_mat_vec<1>(f_ov_src,f_tgt);
-    }
+    // Recall that in these y=Ax products, x is the overlapped src field,
+    // and y is the tgt field.
+    x_batch.push_back(m_ov_fields[i]);
+    y_batch.push_back(f_tgt);
   }
+  local_mat_vec(x_batch,y_batch);
 
   // Close exposure RMA epoch on each field
   for (int i=0; i<m_num_fields; ++i) {
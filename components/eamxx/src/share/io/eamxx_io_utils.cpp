@@ -119,6 +119,22 @@ util::TimeStamp read_timestamp (const std::string& filename,
   return ts;
 }
 
+std::string get_full_restart_filename (const std::string& filename)
+{
+  if (scorpio::has_attribute(filename,"GLOBAL","full_restart_filename")) {
+    const auto full_filename = scorpio::get_attribute<std::string>(filename,"GLOBAL","full_restart_filename");
+    EKAT_REQUIRE_MSG (std::ifstream(full_filename).good(),
+        "Error! Could not find the full restart file needed by an incremental restart file.\n"
+        "   restart file     : " + filename + "\n"
+        "   full restart file: " + full_filename + "\n"
+        " The full restart file was written at an earlier restart step, and is listed in rpointer.atm\n"
+        " next to the restart file. If restart sets were archived in separate folders (e.g., by the\n"
+        " short-term archiver), copy the full restart file from its set into the run directory.\n");
+    return full_filename;
+  }
+  return filename;
+}
+
 std::shared_ptr<AtmosphereDiagnostic>
 create_diagnostic (const std::string& diag_field_name,
                    const std::shared_ptr<const AbstractGrid>& grid)
@@ -83,6 +83,13 @@ util::TimeStamp read_timestamp (const std::string& filename,
                                 const std::string& ts_name,
                                 const bool read_nsteps = false);
 
+// Incremental model restart files only store the fields that changed since the
+// last full restart file, and store the name of the latter in a global attribute.
+// Returns the name of the full restart file associated with the input restart
+// file (which is the input file itself, if that is a full restart file).
+// Throws if the full restart file is not found.
+std::string get_full_restart_filename (const std::string& filename);
+
 // Create a diagnostic from a string representation of it.
 // E.g., create the diag to compute fieldX_at_500hPa.
 std::shared_ptr<AtmosphereDiagnostic>
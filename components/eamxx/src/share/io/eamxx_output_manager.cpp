@@ -448,6 +448,10 @@ void OutputManager::run(const util::TimeStamp& timestamp)
         rpointer.open("rpointer.atm",std::ofstream::app);  // Open rpointer file and append to it
       }
       rpointer << filespecs.filename << std::endl;
+      if (m_is_model_restart_output and m_num_incremental_restarts>0) {
+        // An incremental restart file also needs the full restart file it refers to
+        rpointer << m_full_restart_filename << std::endl;
+      }
     }
 
     if (m_atm_logger) {
@@ -457,7 +461,13 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   };
 
   if (is_output_step) {
+    if (m_is_model_restart_output and m_full_restart_frequency>1) {
+      select_restart_fields();
+    }
     setup_output_file(m_output_control,m_output_file_specs);
+    if (m_is_model_restart_output and m_num_incremental_restarts==0) {
+      m_full_restart_filename = m_output_file_specs.filename;
+    }
 
     // Update time (must be done _before_ writing fields)
     update_time(m_output_file_specs.filename,timestamp.days_from(m_case_t0));
@@ -472,6 +482,98 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   }
   stop_timer(timer_root+"::get_new_file");
 
+  if (is_write_step and m_time_bnds.size()>0) {
+    m_time_bnds[1] = timestamp.days_from(m_case_t0);
+  }
+
+  auto write_global_data = [&](IOControl& control, IOFileSpecs& filespecs) {
+    if (m_atm_logger) {
+      m_atm_logger->debug("[OutputManager]: writing globals...\n");
+    }
+
+    // Since we wrote to file we need to reset the timestamps
+    control.last_write_ts = timestamp;
+    control.compute_next_write_ts();
+    control.nsamples_since_last_write = 0;
+
+    if (m_is_model_restart_output) {
+      // Only write nsteps on model restart
+      set_attribute(filespecs.filename,"GLOBAL","nsteps",timestamp.get_num_steps());
+      if (m_num_incremental_restarts>0) {
+        // Fields not in this file must be read from the last full restart file
+        set_attribute(filespecs.filename,"GLOBAL","full_restart_filename",m_full_restart_filename);
+      }
+    } else {
+      if (filespecs.ftype==FileType::HistoryRestart) {
+        // Update the date of last write and sample size
+        write_timestamp (filespecs.filename,"last_write",m_output_control.last_write_ts,true);
+        scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_filename",m_output_file_specs.filename);
+        scorpio::set_attribute (filespecs.filename,"GLOBAL","num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
+        scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_file_num_snaps",m_output_file_specs.storage.num_snapshots_in_file);
+      }
+      // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
+      // output, and the latter b/c we want to make sure these params don't change across restarts
+      set_attribute(filespecs.filename,"GLOBAL","averaging_type",e2str(m_avg_type));
+      set_attribute(filespecs.filename,"GLOBAL","averaging_frequency_units",m_output_control.frequency_units);
+      set_attribute(filespecs.filename,"GLOBAL","averaging_frequency",m_output_control.frequency);
+      set_attribute(filespecs.filename,"GLOBAL","file_max_storage_type",e2str(m_output_file_specs.storage.type));
+      if (m_output_file_specs.storage.type==NumSnaps) {
+        set_attribute(filespecs.filename,"GLOBAL","max_snapshots_per_file",m_output_file_specs.storage.max_snapshots_in_file);
+      }
+      const auto& fp_precision = m_params.get<std::string>("Floating Point Precision");
+      set_attribute(filespecs.filename,"GLOBAL","fp_precision",fp_precision);
+    }
+
+    // Write all stored globals
+    for (const auto& it : m_globals) {
+      const auto& name = it.first;
+      const auto& any = it.second;
+      if (any.isType<int>()) {
+        set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<int>(any));
+      } else if (any.isType<std::int64_t>()) {
+        set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<std::int64_t>(any));
+      } else if (any.isType<float>()) {
+        set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<float>(any));
+      } else if (any.isType<double>()) {
+        set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<double>(any));
+      } else if (any.isType<std::string>()) {
+        set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<std::string>(any));
+      } else {
+        EKAT_ERROR_MSG (
+            "Error! Invalid concrete type for IO global.\n"
+            " - global name: " + it.first + "\n"
+            " - type id    : " + any.content().type().name() + "\n");
+      }
+    }
+
+    // We're adding one snapshot to the file
+    filespecs.storage.update_storage(timestamp);
+
+    // NOTE: for checkpoint files, unless we write restart data, we did not update time,
+    //       which means we cannot write any variable (the check var.num_records==time.length
+    //       would fail)
+    if (m_time_bnds.size()>0 and
+        (filespecs.ftype!=FileType::HistoryRestart or is_full_checkpoint_step)) {
+      scorpio::write_var(filespecs.filename, "time_bnds", m_time_bnds.data());
+    }
+  };
+
+  // Since write_global_data resets the number of samples, store it for the output streams
+  const int nsamples_since_last_write = m_output_control.nsamples_since_last_write;
+
+  // In async mode, the output streams only queue their writes (see async_io), and any other
+  // operation on the file waits for them to complete. Hence, write the globals of the output
+  // file now, so that the writes stay pending while the model runs, until the next operation
+  // on the file (next output step, or file close).
+  // Important! Process output file first, and hist restart (if any) second.
+  // That's b/c write_global_data will update m_output_control.last_write_ts,
+  // which is later written as global data in the hist restart file
+  start_timer(timer_root+"::update_snapshot_tally");
+  if (is_output_step) {
+    write_global_data(m_output_control,m_output_file_specs);
+  }
+  stop_timer(timer_root+"::update_snapshot_tally");
+
   // Run the output streams
   start_timer(timer_root+"::run_output_streams");
   const auto& fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
@@ -480,108 +582,31 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     if (m_atm_logger) {
       m_atm_logger->debug("[OutputManager]: writing fields from grid " + it->get_io_grid()->name() + "...\n");
     }
-    it->run(fields_write_filename,is_output_step,is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output);
+    it->run(fields_write_filename,is_output_step,is_full_checkpoint_step,nsamples_since_last_write,is_t0_output);
   }
   stop_timer(timer_root+"::run_output_streams");
 
   if (is_write_step) {
-    if (m_time_bnds.size()>0) {
-      m_time_bnds[1] = timestamp.days_from(m_case_t0);
-    }
-
     // If we write output, reset local views
     if (is_output_step) {
       for (auto& it : m_output_streams) {
         it->reset_dev_views();
       }
+      close_or_flush_if_needed(m_output_file_specs,m_output_control);
     }
 
-    auto write_global_data = [&](IOControl& control, IOFileSpecs& filespecs) {
-      if (m_atm_logger) {
-        m_atm_logger->debug("[OutputManager]: writing globals...\n");
-      }
-
-      // Since we wrote to file we need to reset the timestamps
-      control.last_write_ts = timestamp;
-      control.compute_next_write_ts();
-      control.nsamples_since_last_write = 0;
-
-      if (m_is_model_restart_output) {
-        // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"GLOBAL","nsteps",timestamp.get_num_steps());
-      } else {
-        if (filespecs.ftype==FileType::HistoryRestart) {
-          // Update the date of last write and sample size
-          write_timestamp (filespecs.filename,"last_write",m_output_control.last_write_ts,true);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_filename",m_output_file_specs.filename);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_file_num_snaps",m_output_file_specs.storage.num_snapshots_in_file);
-        }
-        // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
-        // output, and the latter b/c we want to make sure these params don't change across restarts
-        set_attribute(filespecs.filename,"GLOBAL","averaging_type",e2str(m_avg_type));
-        set_attribute(filespecs.filename,"GLOBAL","averaging_frequency_units",m_output_control.frequency_units);
-        set_attribute(filespecs.filename,"GLOBAL","averaging_frequency",m_output_control.frequency);
-        set_attribute(filespecs.filename,"GLOBAL","file_max_storage_type",e2str(m_output_file_specs.storage.type));
-        if (m_output_file_specs.storage.type==NumSnaps) {
-          set_attribute(filespecs.filename,"GLOBAL","max_snapshots_per_file",m_output_file_specs.storage.max_snapshots_in_file);
-        }
-        const auto& fp_precision = m_params.get<std::string>("Floating Point Precision");
-        set_attribute(filespecs.filename,"GLOBAL","fp_precision",fp_precision);
-      }
-
-      // Write all stored globals
-      for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = it.second;
-        if (any.isType<int>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<int>(any));
-        } else if (any.isType<std::int64_t>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<std::int64_t>(any));
-        } else if (any.isType<float>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<float>(any));
-        } else if (any.isType<double>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<double>(any));
-        } else if (any.isType<std::string>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<std::string>(any));
-        } else {
-          EKAT_ERROR_MSG (
-              "Error! Invalid concrete type for IO global.\n"
-              " - global name: " + it.first + "\n"
-              " - type id    : " + any.content().type().name() + "\n");
-        }
-      }
-
-      // We're adding one snapshot to the file
-      filespecs.storage.update_storage(timestamp);
-
-      // NOTE: for checkpoint files, unless we write restart data, we did not update time,
-      //       which means we cannot write any variable (the check var.num_records==time.length
-      //       would fail)
-      if (m_time_bnds.size()>0 and
-          (filespecs.ftype!=FileType::HistoryRestart or is_full_checkpoint_step)) {
-        scorpio::write_var(filespecs.filename, "time_bnds", m_time_bnds.data());
-      }
-
-      close_or_flush_if_needed(filespecs,control);
-    };
-
-    start_timer(timer_root+"::update_snapshot_tally");
-    // Important! Process output file first, and hist restart (if any) second.
-    // That's b/c write_global_data will update m_output_control.last_write_ts,
-    // which is later written as global data in the hist restart file
-    if (is_output_step) {
-      write_global_data(m_output_control,m_output_file_specs);
-    }
+    // Checkpoints are rare, so we don't bother avoiding the wait for pending writes here
     if (is_checkpoint_step) {
+      start_timer(timer_root+"::update_snapshot_tally");
       write_global_data(m_checkpoint_control,m_checkpoint_file_specs);
+      close_or_flush_if_needed(m_checkpoint_file_specs,m_checkpoint_control);
+      stop_timer(timer_root+"::update_snapshot_tally");
 
       // Always flush output during checkpoints (assuming we opened it already)
       if (m_output_file_specs.is_open) {
         scorpio::flush_file (m_output_file_specs.filename);
       }
     }
-    stop_timer(timer_root+"::update_snapshot_tally");
     if (is_output_step && m_time_bnds.size()>0) {
       m_time_bnds[0] = m_time_bnds[1];
     }
@@ -620,6 +645,9 @@ void OutputManager::finalize()
   m_case_t0 = {};
   m_run_t0 = {};
   m_atm_logger = {};
+  m_num_incremental_restarts = 0;
+  m_full_restart_filename = {};
+  m_full_restart_hashes = {};
 }
 
 long long OutputManager::res_dep_memory_footprint () const {
@@ -698,6 +726,11 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
 
     // Hard code some parameters in case we access them later
     m_params.set<std::string>("Floating Point Precision","real");
+
+    m_full_restart_frequency = m_params.get("full_restart_frequency",1);
+    EKAT_REQUIRE_MSG (m_full_restart_frequency>0,
+        "Error! Invalid full_restart_frequency (" + std::to_string(m_full_restart_frequency) + ") for model restart.\n"
+        "       Please, use a positive number (1 means every restart file is a full one).\n");
   } else {
     auto avg_type = m_params.get<std::string>("Averaging Type");
     m_avg_type = str2avg(avg_type);
@@ -922,6 +955,46 @@ close_or_flush_if_needed (      IOFileSpecs& file_specs,
   }
 }
 
+void OutputManager::
+select_restart_fields ()
+{
+  std::vector<std::map<std::string,bfbhash::HashType>> hashes;
+  for (const auto& stream : m_output_streams) {
+    hashes.push_back(stream->compute_fields_hashes());
+  }
+
+  // The first restart of the run is always a full one, since we don't have any
+  // full restart file to refer to (we may be restarting from an incremental one)
+  const bool full = m_full_restart_hashes.empty() or
+                    m_num_incremental_restarts+1==m_full_restart_frequency;
+  if (full) {
+    m_full_restart_hashes = hashes;
+    m_num_incremental_restarts = 0;
+    for (auto& stream : m_output_streams) {
+      stream->set_skipped_fields({});
+    }
+    return;
+  }
+
+  ++m_num_incremental_restarts;
+  int num_skipped = 0;
+  for (size_t i=0; i<m_output_streams.size(); ++i) {
+    std::set<std::string> unchanged;
+    for (const auto& [name,hash] : hashes[i]) {
+      if (hash==m_full_restart_hashes[i].at(name)) {
+        unchanged.insert(name);
+      }
+    }
+    num_skipped += unchanged.size();
+    m_output_streams[i]->set_skipped_fields(unchanged);
+  }
+
+  if (m_atm_logger) {
+    m_atm_logger->info("[EAMxx::output_manager] - Incremental restart: skipping " + std::to_string(num_skipped) +
+                       " fields unchanged since " + m_full_restart_filename);
+  }
+}
+
 void OutputManager::
 push_to_logger()
 {
@@ -138,6 +138,10 @@ protected:
   void close_or_flush_if_needed (      IOFileSpecs& file_specs,
                                  const IOControl&   control) const;
 
+  // For incremental model restart, decide whether the next restart file is a full one,
+  // and, if not, which fields can be skipped since unchanged from the last full one
+  void select_restart_fields ();
+
   // Manage logging of info to atm.log
   void push_to_logger();
 
@@ -191,6 +195,16 @@ protected:
 
   // If true, we save grid data in output file
   bool m_save_grid_data;
+
+  // Incremental model restart: a full restart file is written every m_full_restart_frequency
+  // restart steps. The restart files in between only contain the fields that changed since
+  // the last full restart file, and store the name of the latter (see get_full_restart_filename).
+  // Since PIO writes are collective over a whole variable, we detect changes per field,
+  // by comparing its global hash with the one at the time of the last full restart.
+  int                                                   m_full_restart_frequency = 1;
+  int                                                   m_num_incremental_restarts = 0;
+  std::string                                           m_full_restart_filename;
+  std::vector<std::map<std::string,bfbhash::HashType>>  m_full_restart_hashes;
 };
 
 } // namespace scream
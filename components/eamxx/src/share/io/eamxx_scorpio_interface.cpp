@@ -8,7 +8,13 @@
 
 #include <pio.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 namespace scream {
 namespace scorpio {
@@ -18,6 +24,98 @@ struct OffsetsVec {
   std::vector<PIO_Offset> vec;
 };
 
+// A background thread that performs the writes queued by write_var_async.
+// PIO is not thread safe, and its calls are (mostly) collective. To keep things
+// correct (and deadlock-free), while writes are pending the writer thread is the
+// only one touching PIO: all other scorpio functions first wait for the queue to
+// be drained (see impl::get_file). Hence, writes only overlap with non-IO work.
+// The queue is bounded: if max_pending writes are already queued, push blocks.
+class AsyncWriter
+{
+public:
+  using task_t = std::function<void()>;
+
+  ~AsyncWriter () { stop(); }
+
+  void push (task_t&& task) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (not m_thread.joinable()) {
+      m_stop = false;
+      m_thread = std::thread([this]() { loop(); });
+    }
+    m_cv.wait(lock,[this]() { return static_cast<int>(m_tasks.size())<max_pending; });
+    m_tasks.emplace_back(std::move(task));
+    m_cv.notify_all();
+  }
+
+  // Wait for all queued writes to complete, and rethrow any exception they raised
+  void wait () {
+    if (std::this_thread::get_id()==m_thread.get_id()) {
+      // Called from a write running on the writer thread: nothing to wait for.
+      return;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock,[this]() { return m_tasks.empty() and not m_busy; });
+    if (m_error) {
+      auto e = m_error;
+      m_error = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+  void stop () {
+    if (not m_thread.joinable()) {
+      return;
+    }
+    wait();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+  }
+
+  int max_pending = 64;
+
+private:
+
+  void loop () {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_cv.wait(lock,[this]() { return m_stop or not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // Stop was requested, and nothing is left to do
+        return;
+      }
+      auto task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      m_busy = true;
+      lock.unlock();
+      try {
+        task();
+      } catch (...) {
+        lock.lock();
+        if (not m_error) {
+          m_error = std::current_exception();
+        }
+        lock.unlock();
+      }
+      lock.lock();
+      m_busy = false;
+      m_cv.notify_all();
+    }
+  }
+
+  std::thread               m_thread;
+  std::mutex                m_mutex;
+  std::condition_variable   m_cv;
+  std::deque<task_t>        m_tasks;
+  std::exception_ptr        m_error;
+  bool                      m_busy = false;
+  bool                      m_stop = false;
+};
+
 // This class is an implementation detail, and therefore it is hidden inside
 // a cpp file. All customers of IO capabilities must use the common interfaces
 // exposed in the header file of this source file.
@@ -36,17 +134,17 @@ public:
   strmap_t<PIOFile>                     files;
   strmap_t<std::shared_ptr<PIODecomp>>  decomps;
 
-  // In the above map, we would like to label decomps as dtype_dim1$N1_dim2$N2...
-  // where N$i is the global length of dim$i. However, it *may* happen that we use
-  // two different decompositions for the same global layout, which would clash
-  // the names. For this reason, we append at the end an increasing counter,
-  // which disambiguate between globally-equivalent partitions.
-  // When adding a new decomp, we check this map to see if another decomp
-  // already exists with the same global layout. If so, we first check to see
-  // if that decomp is equivalent to the new one *on all ranks*. If yes, we
-  // recycle it, otherwise we create a new PIO decomp.
-  // strmap_t<std::list<std::string>>    decomp_global_layout_to_decomp_name;
-  // strmap_t<int>                       decomp_global_layout_to_counter;
+  // The decomps are shared by all files, and are kept until the subsystem is
+  // finalized, so that history, restart, and geo-data streams do not pay for
+  // PIOc_init_decomp more than once per layout. They are keyed by dtype, global
+  // layout, and a global hash of the offsets of the decomposed dim (see set_var_decomp),
+  // so that two dims with the same length but a different dofs distribution
+  // never share a decomp, while identical layouts do, regardless of dims names.
+
+  // The writer thread for async writes. It is only used if MPI was
+  // initialized with MPI_THREAD_MULTIPLE (async_supported=1).
+  AsyncWriter async_writer;
+  int         async_supported  = -1;
 
   int         pio_sysid        = -1;
   int         pio_type_default = -1;
@@ -269,6 +367,9 @@ PIOFile& get_file (const std::string& filename,
 {
   auto& s = ScorpioSession::instance();
 
+  // Any operation on a file must wait for pending async writes (see AsyncWriter)
+  s.async_writer.wait();
+
   EKAT_REQUIRE_MSG (s.files.count(filename)==1,
       "Error! Could not retrieve the file. File not open.\n"
       " - filename: " + filename + "\n"
@@ -369,6 +470,9 @@ void finalize_subsystem ()
   EKAT_REQUIRE_MSG (s.pio_sysid!=-1,
       "Error! PIO subsystem was already finalized.\n");
 
+  // Complete all pending async writes, and shut down the writer thread
+  s.async_writer.stop();
+
   for (const auto& [filename,file] : s.files) {
     EKAT_REQUIRE_MSG (file.num_customers==0,
       "Error! ScorpioSession::finalize called, but a file is still in use elsewhere.\n"
@@ -404,6 +508,10 @@ void register_file (const std::string& filename,
                     const IOType iotype)
 {
   auto& s = ScorpioSession::instance();
+
+  // Opening a file is collective, and must not overlap with pending async writes
+  s.async_writer.wait();
+
   auto& f = s.files[filename];
   EKAT_REQUIRE_MSG (f.mode==Unset || f.mode==mode,
       "Error! File was already opened with a different mode.\n"
@@ -746,6 +854,37 @@ void reset_time_dim_len (const std::string& filename, const int new_length)
 
 // =================== Decompositions operations ==================== //
 
+// Hash of the offsets of a decomposed dim, combined across all ranks. Dims with
+// the same length and hash have (barring a 64-bit collision) the same dofs
+// distribution, so the PIO decomps that use them are interchangeable.
+std::uint64_t global_offsets_hash (const std::vector<int>& my_offsets)
+{
+  // murmur3 finalizer
+  auto mix = [](std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+  };
+
+  // Include the rank, so that swapping offsets between ranks changes the hash
+  const auto& comm = ScorpioSession::instance().comm;
+  std::uint64_t h = mix(comm.rank()+1);
+  h = mix(h ^ my_offsets.size());
+  for (auto o : my_offsets) {
+    h = mix(h ^ static_cast<std::uint64_t>(o));
+  }
+
+  std::uint64_t global_h;
+  int err = MPI_Allreduce(&h,&global_h,1,MPI_UINT64_T,MPI_BXOR,comm.mpi_comm());
+  EKAT_REQUIRE_MSG (err==MPI_SUCCESS,
+      "Error! Something went wrong while hashing the offsets of a decomposed dim.\n"
+      " - MPI_Allreduce error code: " + std::to_string(err) + "\n");
+  return global_h;
+}
+
 // NOTES:
 //  - this is a local function, we don't expose it. It's only called inside other scorpio utilities
 //  - we don't really *need* filename, it's only to print more context in case of errors
@@ -776,12 +915,16 @@ void set_var_decomp (PIOVar& var,
       " - varname : " + var.name  + "\n"
       " - var dims: " + ekat::join(var.dims,get_entity_name,",") + "\n");
 
-  // Create decomp name: dtype-dim1<len1>_dim2<len2>_..._dimk<lenN>
+  // Create decomp name: dtype-<len1>_<len2>d_..._<lenN>-<hash>, where 'd' marks the
+  // decomposed dim, and hash is the global hash of its offsets. Dims names are
+  // not part of the tag, so that different files (or dims) with the same layout
+  // and dofs distribution can share the decomp.
   std::string decomp_tag = var.dtype + "-";
   for (auto d : var.dims) {
-    decomp_tag += d->name + "<" + std::to_string(d->length) + ">_";
+    decomp_tag += "<" + std::to_string(d->length) + ">" + (d->decomposed ? "d" : "") + "_";
   }
-  decomp_tag.pop_back(); // remove trailing underscore
+  decomp_tag.back() = '-';
+  decomp_tag += std::to_string(decomp_dim->offsets_hash);
 
   // Check if a decomp with this name already exists
   auto& s = ScorpioSession::instance();
@@ -886,7 +1029,9 @@ void set_dim_decomp (const std::string& filename,
       // so that we can free them later *if no other users of them remain*.
       std::set<std::string> decomps_to_remove;
       for (auto& [varname,var] : f.vars) {
-        if (var->decomp!=nullptr and var->decomp->dim->name==dimname) {
+        // NOTE: the decomp may have been created for another file, so check the var dims,
+        //       rather than the dim stored in the decomp
+        if (var->decomp!=nullptr and ekat::contains(var->dim_names(),dimname)) {
           decomps_to_remove.insert(var->decomp->name);
           var->decomp = nullptr;
         }
@@ -940,6 +1085,7 @@ void set_dim_decomp (const std::string& filename,
       " - all offsets (sorted): " + ekat::join(all_offsets,",") + "\n");
 #endif
   dim.offsets = my_offsets;
+  dim.offsets_hash = global_offsets_hash(my_offsets);
   dim.decomposed = true;
 
   // If vars were already defined, we need to process them,
@@ -1093,6 +1239,40 @@ void define_var (const std::string& filename, const std::string& varname,
   define_var(filename,varname,"",dimensions,dtype,dtype,time_dependent);
 }
 
+bool set_var_deflate (const std::string& filename, const std::string& varname,
+                      const int level, const bool shuffle)
+{
+  auto& f = impl::get_file(filename,"scorpio::set_var_deflate");
+
+  EKAT_REQUIRE_MSG (f.mode==Write and not f.enddef,
+      "Error! Variable compression can only be set on new files, while in define mode.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n"
+      " - mode    : " + e2str(f.mode) + "\n");
+  EKAT_REQUIRE_MSG (f.vars.count(varname)==1,
+      "Error! Could not set variable compression. Variable not found.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (level>=0 and level<=9,
+      "Error! Invalid deflate level.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n"
+      " - level   : " + std::to_string(level) + "\n"
+      " - valid range: [0,9]\n");
+
+  // Note: we must not call PIOc_def_var_deflate on non-netCDF-4 files,
+  //       since PIO would invoke its error handler (which may abort)
+  const int iotype = pio_iotype(f.iotype);
+  if (level==0 or (iotype!=PIO_IOTYPE_NETCDF4C and iotype!=PIO_IOTYPE_NETCDF4P)) {
+    return false;
+  }
+
+  const auto& var = f.vars.at(varname);
+  int err = PIOc_def_var_deflate(f.ncid,var->ncid,shuffle ? 1 : 0,1,level);
+  check_scorpio_noerr(err,f.name,"variable",varname,"set_var_deflate","def_var_deflate");
+  return true;
+}
+
 // This overload is not exposed externally. Also, filename is only
 // used to print it in case there are errors
 void change_var_dtype (PIOVar& var,
@@ -1387,6 +1567,40 @@ void write_var (const std::string &filename, const std::string &varname, const T
   check_scorpio_noerr (err,f.name,"variable",varname,"write_var",pioc_func);
 }
 
+template<typename T>
+void write_var_async (const std::string &filename, const std::string &varname, const T* buf)
+{
+  auto& s = ScorpioSession::instance();
+  if (s.async_supported==-1) {
+    // The writer thread calls MPI (inside PIO) while the main thread may do the same
+    int provided;
+    MPI_Query_thread(&provided);
+    s.async_supported = provided==MPI_THREAD_MULTIPLE ? 1 : 0;
+  }
+
+  if (s.async_supported==1) {
+    s.async_writer.push([=]() { write_var(filename,varname,buf); });
+  } else {
+    write_var(filename,varname,buf);
+  }
+}
+
+void wait_async_writes ()
+{
+  ScorpioSession::instance().async_writer.wait();
+}
+
+void set_async_writes_max_pending (const int max_pending)
+{
+  EKAT_REQUIRE_MSG (max_pending>0,
+      "Error! Max number of pending async writes must be positive.\n"
+      " - input value: " + std::to_string(max_pending) + "\n");
+
+  auto& s = ScorpioSession::instance();
+  s.async_writer.wait();
+  s.async_writer.max_pending = max_pending;
+}
+
 // ========================== READ/WRITE ETI ========================== //
 
 template void read_var<int>       (const std::string&, const std::string&, int*,       const int);
@@ -1401,6 +1615,11 @@ template void write_var<float>     (const std::string&, const std::string&, cons
 template void write_var<double>    (const std::string&, const std::string&, const double*,    const double*);
 template void write_var<char>      (const std::string&, const std::string&, const char*,      const char*);
 
+template void write_var_async<int>       (const std::string&, const std::string&, const int*);
+template void write_var_async<long long> (const std::string&, const std::string&, const long long*);
+template void write_var_async<float>     (const std::string&, const std::string&, const float*);
+template void write_var_async<double>    (const std::string&, const std::string&, const double*);
+
 // =============== Attributes operations ================== //
 
 bool has_global_attribute (const std::string& filename, const std::string& attname)
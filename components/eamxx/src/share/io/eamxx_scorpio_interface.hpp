@@ -162,6 +162,13 @@ void define_var (const std::string& filename, const std::string& varname,
                  const std::string& dtype,
                  const bool time_dependent = false);
 
+// Request lossless compression (optional byte shuffle + deflate) of a var.
+// Must be called on a new file (mode=Write), after define_var and before enddef.
+// Only netCDF-4 based iotypes support compression: for other iotypes (or if
+// level=0) this is a no-op, and false is returned.
+bool set_var_deflate (const std::string& filename, const std::string& varname,
+                      const int level, const bool shuffle = true);
+
 // This is useful when reading data sets. E.g., if the pio file is storing
 // a var as float, but we need to read it as double, we need to call this.
 // NOTE: read_var/write_var automatically change the dtype if the input
@@ -205,6 +212,22 @@ void read_var (const std::string &filename, const std::string &varname, T* buf,
 template<typename T>
 void write_var (const std::string &filename, const std::string &varname, const T* buf, const T* fillValue = nullptr);
 
+// Like write_var, but the write is queued, and performed by a background thread.
+// The buffer must stay valid and unchanged until the write completes, which is
+// guaranteed after a call to wait_async_writes. Every other function of this
+// interface waits for pending writes before accessing a file, so that PIO is
+// never used by two threads at once.
+// If MPI does not provide MPI_THREAD_MULTIPLE, this is equivalent to write_var.
+// NOTE: ETI in the cpp file for int, long long, float, double.
+template<typename T>
+void write_var_async (const std::string &filename, const std::string &varname, const T* buf);
+
+// Block until all pending async writes have completed (rethrowing their errors, if any)
+void wait_async_writes ();
+
+// Max number of writes that can be queued before write_var_async blocks (default: 64)
+void set_async_writes_max_pending (const int max_pending);
+
 // =============== Attributes operations ================== //
 
 // To specify GLOBAL attributes, pass "GLOBAL" as varname
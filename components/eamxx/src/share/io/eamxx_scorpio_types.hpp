@@ -66,6 +66,9 @@ struct PIODim : public PIOFileEntity {
   // In case we decompose the dimension, this will store the owned offsets on this rank
   std::vector<int> offsets;
   bool decomposed = false;
+
+  // Hash of the offsets on all ranks, used to share PIO decomps across files
+  std::uint64_t offsets_hash = 0;
 };
 
 // A decomposition
@@ -248,12 +248,16 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
+  // Local number of bytes read, to report the read bandwidth
+  long long nbytes = 0;
+
   for (auto const& name : m_fields_names) {
 
     // Read the data
     auto v1d = m_host_views_1d.at(name);
 
     scorpio::read_var(m_filename,name,v1d.data(),time_index);
+    nbytes += v1d.size()*sizeof(Real);
 
     // If we have a field manager, make sure the data is correctly
     // synced to both host and device views of the field.
@@ -354,14 +358,26 @@ void AtmosphereInput::read_variables (const int time_index)
         }
       }
 
-      // Sync to device
-      f.sync_to_dev();
+      // Sync to device, without fencing, so that the copy overlaps with the
+      // read of the next variables. Each var has its own host view, so the
+      // next reads do not touch the data being copied.
+      f.sync_to_dev(false);
     }
   }
+  if (m_field_mgr) {
+    // Wait for all the syncs to complete
+    Kokkos::fence();
+  }
+
+  m_io_grid->get_comm().all_reduce(&nbytes,1,MPI_SUM);
+
   auto func_finish = std::chrono::steady_clock::now();
   if (m_atm_logger) {
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
+    const double mb = nbytes/1e6;
     m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration.count()) +" seconds");
+    m_atm_logger->info("  Read " + std::to_string(mb) + " MB (" +
+                       std::to_string(duration.count()>0 ? mb/duration.count() : 0.0) + " MB/s)");
   }
 }
 
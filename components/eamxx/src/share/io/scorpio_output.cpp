@@ -12,8 +12,13 @@
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/std_meta/ekat_std_utils.hpp"
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <numeric>
 #include <fstream>
+#include <type_traits>
 
 namespace scream
 {
@@ -73,6 +78,108 @@ void combine_and_fill (const Real& new_val, Real& curr_val, const OutputAvgType
   }
 }
 
+// Find the entry of the accumulation table owning the idx-th entry of the
+// packed storage (entries are sorted by offset, so we can bisect)
+template<typename TableView>
+KOKKOS_INLINE_FUNCTION
+int find_accum_entry (const TableView& table, const int idx)
+{
+  int lo = 0;
+  int hi = table.extent(0)-1;
+  while (lo<hi) {
+    const int mid = (lo+hi+1)/2;
+    if (table(mid).offset<=idx) {
+      lo = mid;
+    } else {
+      hi = mid-1;
+    }
+  }
+  return lo;
+}
+
+// Map the i-th (LayoutRight) entry of a field to its offset in the
+// (possibly padded/strided) field data
+template<typename EntryType>
+KOKKOS_INLINE_FUNCTION
+int accum_src_idx (const EntryType& e, int i)
+{
+  int src_idx = 0;
+  for (int d=e.rank-1; d>=0; --d) {
+    src_idx += (i % e.extents[d])*e.strides[d];
+    i /= e.extents[d];
+  }
+  return src_idx;
+}
+
+// Set the data pointer, extents, and strides of a field in an accumulation table entry
+template<typename EntryType>
+void set_entry_src (EntryType& e, const Field& field)
+{
+  const auto& layout = field.get_header().get_identifier().get_layout();
+  const int rank = layout.rank();
+  EKAT_REQUIRE_MSG (rank<=EntryType::MaxRank,
+      "Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
+
+  e.rank = rank;
+  for (int d=0; d<rank; ++d) {
+    e.extents[d] = layout.dim(d);
+  }
+
+  auto set_src = [&](const auto& v) {
+    e.src = v.data();
+    for (int d=0; d<rank; ++d) {
+      e.strides[d] = v.stride(d);
+    }
+  };
+  switch (rank) {
+    case 0: set_src(field.get_view<const Real,Device>()); break;
+    // For rank-1 views, we use strided layout, since it helps us
+    // handling a few more scenarios
+    case 1: set_src(field.get_strided_view<const Real*,Device>()); break;
+    case 2: set_src(field.get_view<const Real**,Device>()); break;
+    case 3: set_src(field.get_view<const Real***,Device>()); break;
+    case 4: set_src(field.get_view<const Real****,Device>()); break;
+    case 5: set_src(field.get_view<const Real*****,Device>()); break;
+    case 6: set_src(field.get_view<const Real******,Device>()); break;
+  }
+}
+
+// Hash a value, salted with its index, so that moving values around changes the hash
+KOKKOS_INLINE_FUNCTION
+void hash_at (const Real v, const int i, bfbhash::HashType& accum)
+{
+  const double d = v;
+  bfbhash::HashType bits;
+  std::memcpy(&bits,&d,sizeof(bits));
+  bfbhash::hash(bits ^ (static_cast<bfbhash::HashType>(i)*0x9e3779b97f4a7c15ull),accum);
+}
+
+// Round v to nearest (ties to even), keeping only the leading keepbits bits of its
+// mantissa, and zeroing the others ("bit rounding"). Non-finite values are untouched.
+// NOTE: keepbits must be smaller than the number of mantissa bits of Real
+KOKKOS_INLINE_FUNCTION
+Real round_mantissa (const Real v, const int keepbits)
+{
+  using uint_t = typename std::conditional<sizeof(Real)==8,std::uint64_t,std::uint32_t>::type;
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits-1;
+  constexpr uint_t mantissa_mask = (uint_t(1) << mantissa_bits) - 1;
+  constexpr uint_t exponent_mask = (~uint_t(0) >> 1) & ~mantissa_mask;
+
+  uint_t bits;
+  std::memcpy(&bits,&v,sizeof(Real));
+  if ((bits & exponent_mask)==exponent_mask) {
+    return v;
+  }
+
+  const int drop = mantissa_bits - keepbits;
+  bits += ((uint_t(1) << (drop-1)) - 1) + ((bits >> drop) & 1);
+  bits &= ~((uint_t(1) << drop) - 1);
+
+  Real r;
+  std::memcpy(&r,&bits,sizeof(Real));
+  return r;
+}
+
 // This helper function is used to make sure that the list of fields in
 // m_fields_names is a list of unique strings, otherwise throw an error.
 void sort_and_check(std::vector<std::string>& fields)
@@ -211,6 +318,53 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   if (params.isParameter("fill_threshold")) {
     m_avg_coeff_threshold = params.get<Real>("fill_threshold");
   }
+  if (params.isParameter("async_io")) {
+    m_async_io = params.get<bool>("async_io");
+  }
+
+  // Compression options
+  if (params.isSublist("compression")) {
+    const auto& c_pl = params.sublist("compression");
+    if (c_pl.isParameter("deflate_level")) {
+      m_deflate_level = c_pl.get<int>("deflate_level");
+    }
+    if (c_pl.isParameter("shuffle")) {
+      m_shuffle = c_pl.get<bool>("shuffle");
+    }
+    EKAT_REQUIRE_MSG (m_deflate_level>=0 and m_deflate_level<=9,
+        "Error! Invalid value for compression::deflate_level.\n"
+        "  - input value: " + std::to_string(m_deflate_level) + "\n"
+        "  - valid range: [0,9]\n");
+
+    // Default number of significant digits for all fields (0 means no rounding),
+    // which can be overridden on a per-field basis
+    auto set_digits = [&](const std::string& name, const int digits) {
+      EKAT_REQUIRE_MSG (digits>=0,
+          "Error! Invalid number of significant digits for output field.\n"
+          "  - field name : " + name + "\n"
+          "  - input value: " + std::to_string(digits) + "\n");
+      if (digits>0) {
+        m_significant_digits[name] = digits;
+      } else {
+        m_significant_digits.erase(name);
+      }
+    };
+    if (c_pl.isParameter("significant_digits")) {
+      const int digits = c_pl.get<int>("significant_digits");
+      for (const auto& name : m_fields_names) {
+        set_digits(name,digits);
+      }
+    }
+    if (c_pl.isSublist("fields_significant_digits")) {
+      const auto& f_pl = c_pl.sublist("fields_significant_digits");
+      for (auto it=f_pl.params_names_cbegin(); it!=f_pl.params_names_cend(); ++it) {
+        EKAT_REQUIRE_MSG (ekat::contains(m_fields_names,*it),
+            "Error! Significant digits requested for a field that is not in the output stream.\n"
+            "  - field name: " + *it + "\n");
+        set_digits(*it,f_pl.get<int>(*it));
+      }
+    }
+  }
 
   // Helper lambda, to copy io string attributes. This will be used if any
   // remapper is created, to ensure atts set by atm_procs are not lost
@@ -387,8 +541,28 @@ run (const std::string& filename,
       m_atm_logger->info("[EAMxx::scorpio_output] Writing variables to file");
       m_atm_logger->info("  file name: " + filename);
     }
+    if (m_async_io) {
+      // The host views are the staging buffers of the async writes, so we cannot
+      // overwrite them until the previous writes are done. Usually, they already
+      // are, since the OutputManager accesses the file (e.g., to update the time)
+      // before calling this method.
+      start_timer("EAMxx::IO::async_wait");
+      scorpio::wait_async_writes();
+      stop_timer("EAMxx::IO::async_wait");
+    }
   }
 
+  // In async mode, writes are queued, and performed while the model keeps running,
+  // until the next scorpio operation (the OutputManager writes the file globals
+  // before calling this method, so that it does not have to wait before returning).
+  auto write_var = [&](const std::string& fname, const std::string& vname, const Real* data) {
+    if (m_async_io) {
+      scorpio::write_var_async(fname,vname,data);
+    } else {
+      scorpio::write_var(fname,vname,data);
+    }
+  };
+
   using namespace scream::scorpio;
 
   // Update all diagnostics, we need to do this before applying the remapper
@@ -465,12 +639,7 @@ run (const std::string& filename,
   auto fill_value = m_fill_value;
   auto avg_coeff_threshold = m_avg_coeff_threshold;
   for (auto const& name : m_fields_names) {
-    // Get all the info for this field.
-          auto  field = get_field(name,"io");
-    const auto& layout = m_layouts.at(field.name());
-    const auto& dims = layout.dims();
-    const auto  rank = layout.rank();
-
+    auto field = get_field(name,"io");
     if (not field.get_header().get_tracking().get_time_stamp().is_valid()) {
       // Safety check: make sure that the user is ok with this
       if (allow_invalid_fields) {
@@ -480,161 +649,73 @@ run (const std::string& filename,
             "Error! Time-dependent output field '" + name + "' has not been initialized yet\n.");
       }
     }
+  }
 
-    const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
-    const bool is_aliasing_field_view =
-        m_avg_type==OutputAvgType::Instant &&
-        field.get_header().get_alloc_properties().get_padding()==0 &&
-        field.get_header().get_parent()==nullptr &&
-        not is_diagnostic;
-
-    // Manually update the 'running-tally' views with data from the field,
-    // by combining new data with current avg values.
-    // NOTE: this is skipped for instant output, if IO view is aliasing Field view.
-    auto view_dev = m_dev_views_1d.at(name);
-    auto data = view_dev.data();
-    KT::RangePolicy policy(0,layout.size());
-    const auto extents = layout.extents();
-
-    // If the dev_view_1d is aliasing the field device view (must be Instant output),
-    // then there's no point in copying from the field's view to dev_view
-    if (not is_aliasing_field_view) {
-      switch (rank) {
-        case 0:
-        {
-          auto new_view_0d = field.get_view<const Real,Device>();
-          auto avg_view_0d = view_Nd_dev<0>(data);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int) {
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_0d(),avg_view_0d(),avg_type,fill_value);
-            } else {
-              combine(new_view_0d(),avg_view_0d(),avg_type);
-            }
-          });
-          break;
-        }
-        case 1:
-        {
-          // For rank-1 views, we use strided layout, since it helps us
-          // handling a few more scenarios
-          auto new_view_1d = field.get_strided_view<const Real*,Device>();
-          auto avg_view_1d = view_Nd_dev<1>(data,dims[0]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_1d(i),avg_view_1d(i),avg_type,fill_value);
-            } else {
-              combine(new_view_1d(i),avg_view_1d(i),avg_type);
-            }
-          });
-          break;
-        }
-        case 2:
-        {
-          auto new_view_2d = field.get_view<const Real**,Device>();
-          auto avg_view_2d = view_Nd_dev<2>(data,dims[0],dims[1]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j;
-            unflatten_idx(idx,extents,i,j);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_2d(i,j),avg_view_2d(i,j),avg_type,fill_value);
-            } else {
-              combine(new_view_2d(i,j), avg_view_2d(i,j),avg_type);
-            }
-          });
-          break;
-        }
-        case 3:
-        {
-          auto new_view_3d = field.get_view<const Real***,Device>();
-          auto avg_view_3d = view_Nd_dev<3>(data,dims[0],dims[1],dims[2]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k;
-            unflatten_idx(idx,extents,i,j,k);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_3d(i,j,k),avg_view_3d(i,j,k),avg_type,fill_value);
-            } else {
-              combine(new_view_3d(i,j,k), avg_view_3d(i,j,k),avg_type);
-            }
-          });
-          break;
-        }
-        case 4:
-        {
-          auto new_view_4d = field.get_view<const Real****,Device>();
-          auto avg_view_4d = view_Nd_dev<4>(data,dims[0],dims[1],dims[2],dims[3]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l;
-            unflatten_idx(idx,extents,i,j,k,l);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type,fill_value);
-            } else {
-              combine(new_view_4d(i,j,k,l), avg_view_4d(i,j,k,l),avg_type);
-            }
-          });
-          break;
-        }
-        case 5:
-        {
-          auto new_view_5d = field.get_view<const Real*****,Device>();
-          auto avg_view_5d = view_Nd_dev<5>(data,dims[0],dims[1],dims[2],dims[3],dims[4]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m;
-            unflatten_idx(idx,extents,i,j,k,l,m);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type,fill_value);
-            } else {
-              combine(new_view_5d(i,j,k,l,m), avg_view_5d(i,j,k,l,m),avg_type);
-            }
-          });
-          break;
-        }
-        case 6:
-        {
-          auto new_view_6d = field.get_view<const Real******,Device>();
-          auto avg_view_6d = view_Nd_dev<6>(data,dims[0],dims[1],dims[2],dims[3],dims[4],dims[5]);
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
-            int i,j,k,l,m,n;
-            unflatten_idx(idx,extents,i,j,k,l,m,n);
-            if (do_avg_cnt) {
-              combine_and_fill(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n), avg_type,fill_value);
-            } else {
-              combine(new_view_6d(i,j,k,l,m,n), avg_view_6d(i,j,k,l,m,n),avg_type);
-            }
-          });
-          break;
-        }
-        default:
-          EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by AtmosphereOutput.\n");
-      }
+  // Manually update the 'running-tally' views with data from the fields,
+  // by combining new data with current avg values. All fields are handled
+  // by a single kernel, which loops over the packed storage.
+  // NOTE: views aliasing the Field view (must be Instant output) are not in
+  //       the table, since there's no point in copying from the field's view.
+  update_accum_table();
+  const auto table = m_accum_table;
+  KT::RangePolicy policy(0,m_accum_storage.size());
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+    const auto& e = table(find_accum_entry(table,idx));
+    const int i = idx - e.offset;
+    const auto& new_val = e.src[accum_src_idx(e,i)];
+    if (do_avg_cnt) {
+      combine_and_fill(new_val,e.acc[i],avg_type,fill_value);
+    } else {
+      combine(new_val,e.acc[i],avg_type);
     }
+  });
 
-    if (is_write_step) {
-      if (output_step and avg_type==OutputAvgType::Average) {
+  if (is_write_step) {
+    if (output_step and avg_type==OutputAvgType::Average) {
+      // Divide by steps count only when the summation is complete
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        const auto& e = table(find_accum_entry(table,idx));
+        const int i = idx - e.offset;
+        auto& val = e.acc[i];
         if (do_avg_cnt) {
-          const auto avg_cnt_lookup = m_field_to_avg_cnt_map.at(name);
-          const auto avg_cnt_view = m_dev_views_1d.at(avg_cnt_lookup);
-          const auto avg_nsteps = avg_cnt_view.data();
-          // Divide by steps count only when the summation is complete
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            Real coeff_percentage = Real(avg_nsteps[i])/nsteps_since_last_output;
-            if (data[i] != fill_value && coeff_percentage > avg_coeff_threshold) {
-              data[i] /= avg_nsteps[i];
-            } else {
-              data[i] = fill_value;
-            }
-          });
+          Real coeff_percentage = Real(e.cnt[i])/nsteps_since_last_output;
+          if (val != fill_value && coeff_percentage > avg_coeff_threshold) {
+            val /= e.cnt[i];
+          } else {
+            val = fill_value;
+          }
         } else {
-          // Divide by steps count only when the summation is complete
-          Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
-            data[i] /= nsteps_since_last_output;
-          });
+          val /= nsteps_since_last_output;
+        }
+      });
+    }
+
+    // Round values to the requested significant digits. Checkpoint files must store
+    // the exact running tallies, so we only do this on output steps. Since the local
+    // views are reset (or overwritten, for Instant output) after each output step,
+    // we can round them in place.
+    if (output_step and not m_significant_digits.empty()) {
+      Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int idx) {
+        const auto& e = table(find_accum_entry(table,idx));
+        auto& val = e.acc[idx - e.offset];
+        if (e.keepbits>=0 and val!=fill_value) {
+          val = round_mantissa(val,e.keepbits);
         }
+      });
+    }
+
+    // Bring data to host (packed views all at once)
+    Kokkos::deep_copy (m_accum_storage_h,m_accum_storage);
+    for (auto const& name : m_fields_names) {
+      if (m_skipped_fields.count(name)==1) {
+        continue;
       }
-      // Bring data to host
       auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
+      if (not ekat::contains(m_accum_names,name)) {
+        Kokkos::deep_copy (view_host,m_dev_views_1d.at(name));
+      }
       auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,name,view_host.data());
+      write_var(filename,name,view_host.data());
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
@@ -642,13 +723,12 @@ run (const std::string& filename,
   }
   // Handle writing the average count variables to file
   if (is_write_step) {
+    // Bring data to host (all avg count views at once)
+    Kokkos::deep_copy (m_avg_cnt_storage_h,m_avg_cnt_storage);
     for (const auto& name : m_avg_cnt_names) {
-      auto& view_dev = m_dev_views_1d.at(name);
-      // Bring data to host
       auto view_host = m_host_views_1d.at(name);
-      Kokkos::deep_copy (view_host,view_dev);
       auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,name,view_host.data());
+      write_var(filename,name,view_host.data());
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
@@ -656,11 +736,47 @@ run (const std::string& filename,
   }
   if (is_write_step) {
     if (m_atm_logger) {
-      m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+      // In async mode, we only measured the time needed to queue the writes
+      if (m_async_io) {
+        m_atm_logger->info("  Done! Writes queued in: " + std::to_string(duration_write/1000.0) +" seconds");
+      } else {
+        m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+      }
     }
   }
 } // run
 
+std::map<std::string,bfbhash::HashType> AtmosphereOutput::
+compute_fields_hashes () const
+{
+  EKAT_REQUIRE_MSG (m_diagnostics.empty() and not m_horiz_remapper and not m_vert_remapper,
+      "Error! Fields hashes are only available for output streams without remap and diagnostics.\n");
+
+  using bfbhash::HashType;
+
+  // Note: m_fields_names is sorted, so the hashes are in the same order on all ranks
+  const int nfields = m_fields_names.size();
+  std::vector<HashType> local(nfields), global(nfields);
+  for (int n=0; n<nfields; ++n) {
+    AccumEntry e;
+    set_entry_src(e,get_field(m_fields_names[n],"io"));
+
+    KT::RangePolicy policy(0,m_layouts.at(m_fields_names[n]).size());
+    Kokkos::parallel_reduce(policy, KOKKOS_LAMBDA(const int i, HashType& accum) {
+      hash_at(e.src[accum_src_idx(e,i)],i,accum);
+    }, bfbhash::HashReducer<>(local[n]));
+  }
+  Kokkos::fence();
+
+  bfbhash::all_reduce_HashType(m_comm.mpi_comm(),local.data(),global.data(),nfields);
+
+  std::map<std::string,HashType> hashes;
+  for (int n=0; n<nfields; ++n) {
+    hashes[m_fields_names[n]] = global[n];
+  }
+  return hashes;
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
   long long rdmf = 0;
@@ -827,23 +943,30 @@ void AtmosphereOutput::register_views()
     // would be strided).
     //
     // We also don't want to alias to a diagnostic output since it could share memory
-    // with another diagnostic.
+    // with another diagnostic, nor a field that is rounded before being written,
+    // since that would change the field data.
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent()==nullptr &&
-        not is_diagnostic;
+        not is_diagnostic &&
+        m_significant_digits.count(name)==0;
 
     const auto layout = m_layouts.at(field.name());
     const auto size = layout.size();
     if (can_alias_field_view) {
       // Alias field's data, to save storage.
       m_dev_views_1d.emplace(name,view_1d_dev(field.get_internal_view_data<Real,Device>(),size));
-      m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+      if (m_async_io) {
+        // The host view is read by the async writer while the model runs,
+        // so it cannot alias the field host data.
+        m_host_views_1d.emplace(name,view_1d_host("",size));
+      } else {
+        m_host_views_1d.emplace(name,view_1d_host(field.get_internal_view_data<Real,Host>(),size));
+      }
     } else {
-      // Create a local view.
-      m_dev_views_1d.emplace(name,view_1d_dev("",size));
-      m_host_views_1d.emplace(name,Kokkos::create_mirror(m_dev_views_1d[name]));
+      // Will be carved out of the packed storage below
+      m_accum_names.push_back(name);
     }
 
     if (m_track_avg_cnt) {
@@ -853,6 +976,31 @@ void AtmosphereOutput::register_views()
     }
   }
 
+  // Allocate one contiguous storage for all non-aliasing views (and one for
+  // all avg count views), and create the local views as unmanaged slices of it.
+  auto carve_views = [&](const std::vector<std::string>& names,
+                         view_1d_dev& storage, view_1d_host& storage_h,
+                         const std::string& label) {
+    int total_size = 0;
+    for (const auto& name : names) {
+      total_size += m_layouts.at(name).size();
+    }
+    storage   = view_1d_dev(label,total_size);
+    storage_h = Kokkos::create_mirror(storage);
+    int offset = 0;
+    for (const auto& name : names) {
+      const auto size = m_layouts.at(name).size();
+      m_dev_views_1d.emplace(name,view_1d_dev(storage.data()+offset,size));
+      m_host_views_1d.emplace(name,view_1d_host(storage_h.data()+offset,size));
+      offset += size;
+    }
+  };
+  carve_views(m_accum_names,m_accum_storage,m_accum_storage_h,"accum_storage");
+  carve_views(m_avg_cnt_names,m_avg_cnt_storage,m_avg_cnt_storage_h,"avg_cnt_storage");
+
+  m_accum_table   = accum_table_dev("accum_table",m_accum_names.size());
+  m_accum_table_h = Kokkos::create_mirror_view(m_accum_table);
+
   // Initialize the local views
   reset_dev_views();
 }
@@ -878,7 +1026,6 @@ void AtmosphereOutput::set_avg_cnt_tracking(const std::string& name, const Field
   // Now create and store a dev view to track the averaging count for this layout (if we are tracking)
   // We don't need to track average counts for files that are not tracking the time dim
   const auto& avg_cnt_suffix = m_field_to_avg_cnt_suffix[name];
-  const auto size = layout.size();
   const auto tags = layout.tags();
   if (m_track_avg_cnt) {
     std::string avg_cnt_name = "avg_count" + avg_cnt_suffix;
@@ -898,8 +1045,7 @@ void AtmosphereOutput::set_avg_cnt_tracking(const std::string& name, const Field
       m_avg_cnt_names.push_back(avg_cnt_name);
     }
     m_field_to_avg_cnt_map.emplace(name,avg_cnt_name);
-    m_dev_views_1d.emplace(avg_cnt_name,view_1d_dev("",size));  // Note, emplace will only add a new key if one isn't already there
-    m_host_views_1d.emplace(avg_cnt_name,Kokkos::create_mirror(m_dev_views_1d[avg_cnt_name]));
+    // Note: the view is created in register_views, once all avg count names are known
     m_layouts.emplace(avg_cnt_name,layout);
   }
 }
@@ -908,30 +1054,58 @@ void AtmosphereOutput::
 reset_dev_views()
 {
   // Reset the local device views depending on the averaging type
-  // Init dev view with an "identity" for avg_type
+  // Init dev view with an "identity" for avg_type.
+  // Note: all non-aliasing views live in the same storage, so one deep_copy is enough
   const Real fill_for_average = m_track_avg_cnt ? m_fill_value : 0.0;
-  for (auto const& name : m_fields_names) {
-    switch (m_avg_type) {
-      case OutputAvgType::Instant:
-        // No averaging
-        break;
-      case OutputAvgType::Max:
-        Kokkos::deep_copy(m_dev_views_1d[name],-std::numeric_limits<Real>::infinity());
-        break;
-      case OutputAvgType::Min:
-        Kokkos::deep_copy(m_dev_views_1d[name],std::numeric_limits<Real>::infinity());
-        break;
-      case OutputAvgType::Average:
-        Kokkos::deep_copy(m_dev_views_1d[name],fill_for_average);
-        break;
-      default:
-        EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
-    }
+  switch (m_avg_type) {
+    case OutputAvgType::Instant:
+      // No averaging
+      break;
+    case OutputAvgType::Max:
+      Kokkos::deep_copy(m_accum_storage,-std::numeric_limits<Real>::infinity());
+      break;
+    case OutputAvgType::Min:
+      Kokkos::deep_copy(m_accum_storage,std::numeric_limits<Real>::infinity());
+      break;
+    case OutputAvgType::Average:
+      Kokkos::deep_copy(m_accum_storage,fill_for_average);
+      break;
+    default:
+      EKAT_ERROR_MSG ("Unrecognized averaging type.\n");
   }
   // Reset all views for averaging count to 0
-  for (auto const& name : m_avg_cnt_names) {
-    Kokkos::deep_copy(m_dev_views_1d[name],0);
+  Kokkos::deep_copy(m_avg_cnt_storage,0);
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::
+update_accum_table()
+{
+  int offset = 0;
+  for (size_t n=0; n<m_accum_names.size(); ++n) {
+    const auto& name = m_accum_names[n];
+    const auto field = get_field(name,"io");
+
+    auto& e = m_accum_table_h(n);
+    e.acc = m_dev_views_1d.at(name).data();
+    e.cnt = m_track_avg_cnt ? m_dev_views_1d.at(m_field_to_avg_cnt_map.at(name)).data() : nullptr;
+    e.offset = offset;
+
+    // Note: the data pointer must be retrieved at every step, since
+    // it may change (e.g., for dynamic subfields)
+    set_entry_src(e,field);
+    offset += m_layouts.at(name).size();
+
+    // Keeping ceil(N*log2(10)) mantissa bits preserves N significant digits
+    e.keepbits = -1;
+    auto digits = m_significant_digits.find(name);
+    if (digits!=m_significant_digits.end()) {
+      const int keepbits = std::ceil(digits->second*std::log2(10.0));
+      if (keepbits<std::numeric_limits<Real>::digits-1) {
+        e.keepbits = keepbits;
+      }
+    }
   }
+  Kokkos::deep_copy(m_accum_table,m_accum_table_h);
 }
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
@@ -962,9 +1136,18 @@ register_variables(const std::string& filename,
     }
     return vec_of_dims;
   };
+  bool deflate_unsupported = false;
+  auto set_deflate = [&](const std::string& varname) {
+    if (m_deflate_level>0 and not scorpio::set_var_deflate(filename,varname,m_deflate_level,m_shuffle)) {
+      deflate_unsupported = true;
+    }
+  };
 
   // Cycle through all fields and register.
   for (auto const& name : m_fields_names) {
+    if (m_skipped_fields.count(name)==1) {
+      continue;
+    }
     auto field = get_field(name,"io");
     auto& fid  = field.get_header().get_identifier();
     // Make a unique tag for each decomposition. To reuse decomps successfully,
@@ -1009,6 +1192,7 @@ register_variables(const std::string& filename,
     } else {
       scorpio::define_var (filename, name, units, vec_of_dims,
                             "real",fp_precision, m_add_time_dim);
+      set_deflate(name);
 
       // Add FillValue as an attribute of each variable
       // FillValue is a protected metadata, do not add it if it already existed
@@ -1101,9 +1285,16 @@ register_variables(const std::string& filename,
 	// define the variable.
         scorpio::define_var(filename, name, unitless, vec_of_dims,
                             "real",fp_precision, m_add_time_dim);
+        set_deflate(name);
       }
     }
   }
+
+  if (deflate_unsupported and m_atm_logger) {
+    m_atm_logger->warn("[EAMxx::scorpio_output] Compression not supported by the iotype of this file.\n"
+                       "  file name: " + filename + "\n"
+                       "  Variables will be written uncompressed.\n");
+  }
 } // register_variables
 
 void AtmosphereOutput::set_decompositions(const std::string& filename)
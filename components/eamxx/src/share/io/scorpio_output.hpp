@@ -8,6 +8,7 @@
 #include "share/grid/grids_manager.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
 #include "share/util/eamxx_utils.hpp"
+#include "share/util/eamxx_bfbhash.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
@@ -29,6 +30,7 @@
  *  filename_prefix:                    STRING
  *  Averaging Type:                     STRING
  *  Max Snapshots Per File:             INT                   (default: 1)
+ *  async_io:                           BOOL                  (default: false)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:                  ARRAY OF STRINGS
@@ -63,6 +65,13 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - async_io: if true, at each write step the output data is staged in host buffers, and
+ *    the actual writes are performed by a background thread, while the model keeps running.
+ *    Since PIO is not thread safe, pending writes are completed before any other scorpio
+ *    operation (on any file), e.g., at the next output step, when the file is closed, or
+ *    when another output stream writes. Hence, the writes of the last stream that runs in
+ *    a step are the ones that overlap the most with the model. Requires MPI_THREAD_MULTIPLE
+ *    (otherwise, writes are synchronous).
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -149,6 +158,17 @@ public:
 
   long long res_dep_memory_footprint () const;
 
+  // Global hash of the current data of each output field. This is meant to be called
+  // before run, to detect which fields changed since a previous write, so it is
+  // only available for streams without remappers and diagnostics (e.g., model restart)
+  std::map<std::string,bfbhash::HashType> compute_fields_hashes () const;
+
+  // Fields to leave out of the files from now on: they are neither registered
+  // by setup_output_file, nor written by run
+  void set_skipped_fields (const std::set<std::string>& names) {
+    m_skipped_fields = names;
+  }
+
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
     return m_io_grid;
   }
@@ -174,6 +194,7 @@ protected:
   void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
   void set_decompositions(const std::string& filename);
   void register_views();
+  void update_accum_table();
   Field get_field(const std::string& name, const std::string& mode) const;
   void compute_diagnostic (const std::string& name, const bool allow_invalid_fields = false);
   void set_diagnostics();
@@ -214,6 +235,7 @@ protected:
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
+  std::set<std::string>                                 m_skipped_fields;
   DefaultMetadata                                       m_default_metadata;
 
   // Use float, so that if output fp_precision=float, this is a representable value.
@@ -227,9 +249,50 @@ protected:
   std::map<std::string,view_1d_host>    m_host_views_1d;
   std::map<std::string,view_1d_dev>     m_dev_views_1d;
 
+  // Non-aliasing local views are carved out of a single contiguous allocation,
+  // so that they can be reset with one deep_copy, and updated with one kernel.
+  // Each entry of the accumulation table describes one such field: where to read
+  // the new data from (with its strides), where to accumulate it, and where the
+  // corresponding average count is (if tracked). The table is rebuilt at every
+  // run, since the data pointer of some fields (e.g., dynamic subfields) may change.
+  struct AccumEntry {
+    static constexpr int MaxRank = 6;
+
+    const Real* src;
+    Real*       acc;
+    const Real* cnt;
+    int         offset;
+    int         rank;
+    int         extents[MaxRank];
+    int         strides[MaxRank];
+    int         keepbits; // Mantissa bits kept when rounding for output (-1: no rounding)
+  };
+  using accum_table_dev  = typename KT::template view_1d<AccumEntry>;
+  using accum_table_host = typename accum_table_dev::HostMirror;
+
+  std::vector<std::string>  m_accum_names;
+  accum_table_dev           m_accum_table;
+  accum_table_host          m_accum_table_h;
+  view_1d_dev               m_accum_storage;
+  view_1d_host              m_accum_storage_h;
+  view_1d_dev               m_avg_cnt_storage;
+  view_1d_host              m_avg_cnt_storage_h;
+
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
+  // If true, writes are queued and performed in the background (see scorpio::write_var_async)
+  bool m_async_io = false;
+
+  // Compression settings (see the 'compression' sublist of the output params).
+  // Lossless: byte shuffle + deflate, done by the IO library (netCDF-4 iotypes only).
+  // Lossy: on output steps, values are rounded on device to the requested number
+  // of significant digits, zeroing the trailing mantissa bits. This makes the data
+  // much more compressible, either by the IO library or by post-processing tools.
+  int  m_deflate_level = 0;
+  bool m_shuffle = true;
+  std::map<std::string,int> m_significant_digits;
+
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 };
@@ -0,0 +1,127 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/eamxx_output_manager.hpp"
+#include "share/io/scorpio_input.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/eamxx_setup_random_test.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+#include "share/eamxx_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cmath>
+#include <memory>
+
+namespace scream {
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  // Use non-integer values, so that rounding them does change them
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_real_distribution<Real> pdf (-100,100);
+    return pdf(engine);
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const auto units = ekat::units::Units::nondimensional();
+  for (const std::string& name : {"rounded","exact"}) {
+    FID fid(name,FL({COL,LEV},{nlcols,nlevs}),units,grid->name());
+    Field f(fid);
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+  }
+
+  return fm;
+}
+
+TEST_CASE ("io_compression") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  const int ngcols = std::max(comm.size()-1,1);
+  const int nlevs = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  util::TimeStamp t0({2023,2,17},{0,0,0});
+  auto fm = get_fm(grid,t0,seed);
+  auto fm0 = get_fm(grid,t0,seed);
+
+  // Keep 3 significant digits for all fields, except 'exact'. Also request
+  // deflate compression, which is a no-op if the iotype does not support it.
+  const int digits = 3;
+  ekat::ParameterList om_pl;
+  om_pl.set("filename_prefix",std::string("io_compression"));
+  om_pl.set("Field Names",std::vector<std::string>{"rounded","exact"});
+  om_pl.set("Averaging Type",std::string("INSTANT"));
+  om_pl.set("Floating Point Precision",std::string("real"));
+  om_pl.set("Max Snapshots Per File",1);
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",1);
+  ctrl_pl.set("save_grid_data",false);
+  auto& c_pl = om_pl.sublist("compression");
+  c_pl.set("deflate_level",1);
+  c_pl.set("significant_digits",digits);
+  c_pl.sublist("fields_significant_digits").set("exact",0);
+
+  // Instant output writes the t0 snapshot during setup
+  OutputManager om;
+  om.initialize(comm,om_pl,t0,false);
+  om.setup(fm,gm->get_grid_names());
+  const auto filename = om.output_file_specs().filename;
+  om.finalize();
+
+  // Rounding is done on a copy of the data: the model fields must be untouched
+  for (const std::string& name : {"rounded","exact"}) {
+    REQUIRE (views_are_equal(fm->get_field(name),fm0->get_field(name)));
+  }
+
+  // Read the fields back, in fields inited with the wrong seed
+  auto fm_in = get_fm(grid,t0,-seed-1);
+  AtmosphereInput reader(filename,grid,{fm_in->get_field("rounded"),fm_in->get_field("exact")});
+  reader.read_variables();
+  REQUIRE (views_are_equal(fm_in->get_field("exact"),fm0->get_field("exact")));
+
+  const auto tol = 0.5*std::pow(10.0,1-digits);
+  const auto f   = fm_in->get_field("rounded");
+  const auto f0  = fm0->get_field("rounded");
+  const auto v   = f.get_internal_view_data<const Real,Host>();
+  const auto v0  = f0.get_internal_view_data<const Real,Host>();
+  const int n = f.get_header().get_alloc_properties().get_num_scalars();
+  int num_changed = 0;
+  for (int i=0; i<n; ++i) {
+    REQUIRE (std::abs(v[i]-v0[i])<=tol*std::abs(v0[i]));
+    num_changed += v[i]!=v0[i];
+  }
+  // Random reals need more than 3 digits, so (almost) all values must have changed
+  REQUIRE (num_changed>n/2);
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
@@ -0,0 +1,164 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/eamxx_output_manager.hpp"
+#include "share/io/eamxx_io_utils.hpp"
+#include "share/io/scorpio_input.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/eamxx_setup_random_test.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+#include "share/eamxx_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+namespace scream {
+
+void add (const Field& f, const double v) {
+  auto data = f.get_internal_view_data<Real,Host>();
+  auto nscalars = f.get_header().get_alloc_properties().get_num_scalars();
+  for (int i=0; i<nscalars; ++i) {
+    data[i] += v;
+  }
+  f.sync_to_dev();
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  // A field that never changes, and one that changes every step
+  const auto units = ekat::units::Units::nondimensional();
+  for (const std::string& name : {"static","dynamic"}) {
+    FID fid(name,FL({COL,LEV},{nlcols,nlevs}),units,grid->name());
+    Field f(fid);
+    f.allocate_view();
+    randomize (f,engine,my_pdf);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    fm->add_field(f);
+    fm->add_to_group(name,grid->name(),"RESTART");
+  }
+
+  return fm;
+}
+
+TEST_CASE ("io_incremental_restart") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  const int ngcols = std::max(comm.size()-1,1);
+  const int nlevs = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  util::TimeStamp t0({2023,2,17},{0,0,0});
+  auto fm = get_fm(grid,t0,seed);
+
+  // Write a restart file every step, but only a full one every 3 restarts
+  ekat::ParameterList om_pl;
+  om_pl.set("filename_prefix",std::string("io_incremental_restart"));
+  om_pl.set("full_restart_frequency",3);
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",1);
+
+  OutputManager om;
+  om.initialize(comm,om_pl,t0,true);
+  om.setup(fm,gm->get_grid_names());
+
+  // Read the fields from a restart file, the way the AtmosphereDriver does,
+  // and check that we get the current state
+  auto check_restart = [&](const std::string& filename) {
+    auto fm_in = get_fm(grid,t0,-seed-1);
+    const auto full_filename = get_full_restart_filename(filename);
+    for (const std::string& name : {"static","dynamic"}) {
+      const auto& f_in = fm_in->get_field(name);
+      const auto& src = full_filename==filename or scorpio::has_var(filename,name)
+                      ? filename : full_filename;
+      AtmosphereInput reader(src,grid,{f_in});
+      reader.read_variables();
+      REQUIRE (views_are_equal(f_in,fm->get_field(name)));
+    }
+  };
+
+  const int dt = 1;
+  auto t = t0;
+  std::string filename, full_filename;
+  for (int n=0; n<6; ++n) {
+    om.init_timestep(t,dt);
+    t += dt;
+    add(fm->get_field("dynamic"),1.0);
+    om.run(t);
+
+    filename = om.output_file_specs().filename;
+    if (n%3==0) {
+      // A full restart file
+      REQUIRE (get_full_restart_filename(filename)==filename);
+      REQUIRE (scorpio::has_var(filename,"static"));
+      full_filename = filename;
+    } else {
+      // An incremental restart file, with only the fields that changed
+      REQUIRE (get_full_restart_filename(filename)==full_filename);
+      REQUIRE (not scorpio::has_var(filename,"static"));
+    }
+    REQUIRE (scorpio::has_var(filename,"dynamic"));
+
+    // The rpointer file lists the restart file, and the full restart file it needs
+    std::ifstream rpointer("rpointer.atm");
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(rpointer,line); ) {
+      lines.push_back(line);
+    }
+    REQUIRE (lines.size()==(n%3==0 ? 1 : 2));
+    REQUIRE (lines[0]==filename);
+    REQUIRE (lines.back()==full_filename);
+
+    check_restart(filename);
+  }
+
+  om.finalize();
+
+  // An incremental restart file is unusable without its full restart file
+  comm.barrier();
+  if (comm.am_i_root()) {
+    std::rename(full_filename.c_str(),(full_filename+".moved").c_str());
+  }
+  comm.barrier();
+  REQUIRE_THROWS (get_full_restart_filename(filename));
+  comm.barrier();
+  if (comm.am_i_root()) {
+    std::rename((full_filename+".moved").c_str(),full_filename.c_str());
+  }
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
@@ -247,4 +247,150 @@ TEST_CASE ("write_and_read") {
   finalize_subsystem ();
 }
 
+TEST_CASE ("async_write") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  init_subsystem (comm);
+
+  std::string filename = "scorpio_interface_async_write_test_np" + std::to_string(comm.size()) + ".nc";
+
+  const int ldim = 3;
+  const int gdim = ldim * comm.size();
+  const int nslices = 4;
+
+  std::vector<int> my_offsets;
+  for (int i=0; i<ldim; ++i) {
+    my_offsets.push_back(ldim*comm.rank() + i);
+  }
+
+  // Write phase: keep a separate buffer per slice, since they must
+  // stay valid until the write is complete
+  {
+    REQUIRE_THROWS (set_async_writes_max_pending (0)); // ERROR: must be positive
+    set_async_writes_max_pending (2);
+
+    register_file (filename,Write);
+    define_dim (filename,"dim",gdim);
+    set_dim_decomp (filename,"dim",my_offsets);
+    define_time (filename,"some_units");
+    define_var (filename,"var",{"dim"},"double",true);
+    enddef (filename);
+
+    std::vector<std::vector<double>> bufs (nslices,std::vector<double>(ldim));
+    for (int n=0; n<nslices; ++n) {
+      update_time (filename,n);
+      for (int i=0; i<ldim; ++i) {
+        bufs[n][i] = 100*n + my_offsets[i];
+      }
+      write_var_async (filename,"var",bufs[n].data());
+    }
+    wait_async_writes ();
+
+    // Errors from the async writes are rethrown, at the latest when waiting
+    auto bad_write = [&]() {
+      write_var_async (filename,"not_a_var",bufs[0].data());
+      wait_async_writes ();
+    };
+    REQUIRE_THROWS (bad_write()); // ERROR: var not found
+
+    release_file (filename);
+  }
+
+  // Read phase
+  {
+    register_file (filename,Read);
+    set_dim_decomp (filename,"dim",my_offsets);
+
+    REQUIRE (get_time_len(filename)==nslices);
+    std::vector<double> buf (ldim);
+    for (int n=0; n<nslices; ++n) {
+      read_var (filename,"var",buf.data(),n);
+      for (int i=0; i<ldim; ++i) {
+        REQUIRE (buf[i]==100*n + my_offsets[i]);
+      }
+    }
+
+    release_file (filename);
+  }
+
+  finalize_subsystem ();
+}
+
+TEST_CASE ("shared_decomps") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  init_subsystem (comm);
+
+  // Two files with the same global layout, but a different dofs distribution:
+  // the decomps are shared across files, but only if the offsets match
+  std::string suffix = "_np" + std::to_string(comm.size()) + ".nc";
+  std::string blocked = "scorpio_interface_shared_decomps_blocked" + suffix;
+  std::string strided = "scorpio_interface_shared_decomps_strided" + suffix;
+
+  const int ldim = 3;
+  const int gdim = ldim * comm.size();
+
+  std::vector<int> blocked_offsets, strided_offsets;
+  for (int i=0; i<ldim; ++i) {
+    blocked_offsets.push_back(ldim*comm.rank() + i);
+    strided_offsets.push_back(comm.rank() + i*comm.size());
+  }
+
+  auto setup = [&](const std::string& filename, const FileMode mode,
+                   const std::vector<int>& offsets) {
+    register_file (filename,mode);
+    if (mode==Write) {
+      define_dim (filename,"dim",gdim);
+      define_dim (filename,"other_dim",gdim);
+      define_var (filename,"var",{"dim"},"double",false);
+      define_var (filename,"other_var",{"other_dim"},"double",false);
+    }
+    set_dim_decomp (filename,"dim",offsets);
+    set_dim_decomp (filename,"other_dim",offsets);
+    if (mode==Write) {
+      enddef (filename);
+    }
+  };
+
+  // Write phase: keep both files open, so both decomps are alive at the same time
+  {
+    setup (blocked,Write,blocked_offsets);
+    setup (strided,Write,strided_offsets);
+
+    std::vector<double> buf (ldim);
+    for (int i=0; i<ldim; ++i) buf[i] = blocked_offsets[i];
+    write_var (blocked,"var",buf.data());
+    write_var (blocked,"other_var",buf.data());
+    for (int i=0; i<ldim; ++i) buf[i] = strided_offsets[i];
+    write_var (strided,"var",buf.data());
+    write_var (strided,"other_var",buf.data());
+
+    release_file (blocked);
+    release_file (strided);
+  }
+
+  // Read phase: read each file with the other file's distribution
+  {
+    setup (blocked,Read,strided_offsets);
+    setup (strided,Read,blocked_offsets);
+
+    std::vector<double> buf (ldim);
+    for (const auto& vname : {"var","other_var"}) {
+      read_var (blocked,vname,buf.data());
+      for (int i=0; i<ldim; ++i) {
+        REQUIRE (buf[i]==strided_offsets[i]);
+      }
+      read_var (strided,vname,buf.data());
+      for (int i=0; i<ldim; ++i) {
+        REQUIRE (buf[i]==blocked_offsets[i]);
+      }
+    }
+
+    release_file (blocked);
+    release_file (strided);
+  }
+
+  finalize_subsystem ();
+}
+
 } // namespace scream
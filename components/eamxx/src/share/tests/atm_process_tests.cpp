@@ -325,7 +325,7 @@ public:
     add_field<Updated>("Field A",lt,K,m_grid_name);
   }
 protected:
-    void run_impl (const double /* dt */) {
+  void run_impl (const double /* dt */) {
     auto v = get_field_out("Field A", m_grid_name).get_view<Real*,Host>();
 
     for (int i=0; i<v.extent_int(0); ++i) {
@@ -334,6 +334,38 @@ protected:
   }
 };
 
+class TimesTwo : public DummyProcess
+{
+public:
+  TimesTwo (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_2d_scalar_layout ();
+
+    add_field<Updated>("Field A",lt,K,m_grid_name);
+  }
+protected:
+  void run_impl (const double /* dt */) {
+    auto f = get_field_out("Field A", m_grid_name);
+    f.sync_to_host();
+    auto v = f.get_view<Real*,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      v[i] *= Real(2.0);
+    }
+    f.sync_to_dev();
+  }
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -582,6 +614,57 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("parallel_splitting") {
+  using namespace scream;
+  using strvec_t = std::vector<std::string>;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  auto& factory = AtmosphereProcessFactory::instance();
+  factory.register_product("AddOne",&create_atmosphere_process<AddOne>);
+  factory.register_product("group",&create_atmosphere_process<AtmosphereProcessGroup>);
+  factory.register_product("TimesTwo",&create_atmosphere_process<TimesTwo>);
+
+  // Starting from A=1, sequential splitting gives (1+1)*2=4, while
+  // parallel splitting gives 1 + (2-1) + (2-1) = 3.
+  for (std::string sched : {"Sequential", "Parallel"}) {
+    ekat::ParameterList params ("Atmosphere Processes");
+    params.set<std::string>("schedule_type",sched);
+    params.set<strvec_t>("atm_procs_list",{"AddOne","TimesTwo"});
+    params.sublist("AddOne").set<std::string>("Grid Name", "Point Grid");
+    params.sublist("TimesTwo").set<std::string>("Grid Name", "Point Grid");
+
+    auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(factory.create("group",comm,params));
+    REQUIRE (static_cast<bool>(group));
+    group->set_grids(gm);
+
+    const auto& req = group->get_required_field_requests().front();
+    Field f(req.fid);
+    f.allocate_view();
+    f.deep_copy(1.0);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    group->set_required_field(f.get_const());
+    group->set_computed_field(f);
+
+    group->initialize(t0,RunType::Initial);
+    group->run(1);
+
+    const Real expected = sched=="Sequential" ? 4 : 3;
+    f.sync_to_host();
+    auto v = f.get_view<const Real*,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      REQUIRE (v[i]==expected);
+    }
+  }
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
@@ -6,6 +6,8 @@
 #include "share/util/eamxx_setup_random_test.hpp"
 #include "share/field/field_utils.hpp"
 
+#include <filesystem>
+
 namespace scream {
 
 class CoarseningRemapperTester : public CoarseningRemapper {
@@ -502,4 +504,76 @@ TEST_CASE("coarsening_remap")
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE("coarsening_remap_cache")
+{
+  namespace fs = std::filesystem;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  root_print ("\n +---------------------------------------+\n",comm);
+  root_print (" |   Testing horiz remap data caching    |\n",comm);
+  root_print (" +---------------------------------------+\n\n",comm);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  std::string filename = "cr_cache_tests_map." + std::to_string(comm.size()) + ".nc";
+  const int nldofs_tgt = 2;
+  const int ngdofs_tgt = nldofs_tgt*comm.size();
+  create_remap_file(filename, ngdofs_tgt);
+
+  // Start from an empty cache
+  std::string cache_dir = "cr_cache_tests_dir." + std::to_string(comm.size());
+  if (comm.am_i_root()) {
+    fs::remove_all(cache_dir);
+    fs::create_directory(cache_dir);
+  }
+  comm.barrier();
+  HorizRemapperData::set_cache_dir(cache_dir);
+
+  const int ngdofs_src = ngdofs_tgt+1;
+  auto src_grid = build_src_grid(comm, ngdofs_src, engine);
+
+  // Build the remap data from the map file. Since there are no other customers,
+  // the data is released when the remapper is destroyed.
+  const int num_hits = HorizRemapperData::get_num_cache_hits();
+  auto remap = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  REQUIRE (HorizRemapperData::get_num_cache_hits()==num_hits);
+  auto row_offsets = cmvdc(remap->get_row_offsets());
+  auto col_lids    = cmvdc(remap->get_col_lids());
+  auto weights     = cmvdc(remap->get_weights());
+  auto ov_gids     = remap->get_ov_tgt_grid()->get_dofs_gids().clone();
+  auto gids        = remap->get_coarse_grid()->get_dofs_gids().clone();
+  remap = nullptr;
+
+  // Each rank must have stored its own cache file
+  comm.barrier();
+  int nfiles = std::distance(fs::directory_iterator(cache_dir),fs::directory_iterator{});
+  REQUIRE (nfiles==comm.size());
+
+  // Build again: this time, the data is loaded from the cache, and must match
+  remap = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  REQUIRE (HorizRemapperData::get_num_cache_hits()==num_hits+1);
+  auto row_offsets_c = cmvdc(remap->get_row_offsets());
+  auto col_lids_c    = cmvdc(remap->get_col_lids());
+  auto weights_c     = cmvdc(remap->get_weights());
+  REQUIRE (row_offsets_c.size()==row_offsets.size());
+  REQUIRE (col_lids_c.size()==col_lids.size());
+  for (size_t i=0; i<row_offsets.size(); ++i) {
+    REQUIRE (row_offsets_c(i)==row_offsets(i));
+  }
+  for (size_t i=0; i<col_lids.size(); ++i) {
+    REQUIRE (col_lids_c(i)==col_lids(i));
+    REQUIRE (weights_c(i)==weights(i));
+  }
+  REQUIRE (views_are_equal(ov_gids,remap->get_ov_tgt_grid()->get_dofs_gids()));
+  REQUIRE (views_are_equal(gids,remap->get_coarse_grid()->get_dofs_gids()));
+  remap = nullptr;
+
+  HorizRemapperData::set_cache_dir("");
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
@@ -4,6 +4,7 @@
 #include "share/grid/se_grid.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/grid_utils.hpp"
+#include "share/grid/gid_directory.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
 #include "share/eamxx_types.hpp"
 
@@ -218,4 +219,55 @@ TEST_CASE ("get_remote_pids_and_lids") {
   }
 }
 
+TEST_CASE ("gid_directory") {
+  using gid_type = GidDirectory::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&comm);
+
+  const int num_local_dofs = 10;
+  const int num_global_dofs = num_local_dofs*comm.size();
+  // Create dofs, shuffled them around across ranks.
+  std::vector<gid_type> all_dofs (num_global_dofs);
+  if (comm.am_i_root()) {
+    std::iota(all_dofs.data(),all_dofs.data()+all_dofs.size(),0);
+    std::shuffle(all_dofs.data(),all_dofs.data()+num_global_dofs,engine);
+  }
+  comm.broadcast(all_dofs.data(),num_global_dofs,comm.root_rank());
+
+  const int offset = num_local_dofs*comm.rank();
+  std::vector<gid_type> my_dofs (all_dofs.begin()+offset,all_dofs.begin()+offset+num_local_dofs);
+
+  // Each gid has exactly one owner, found at its position in all_dofs
+  GidDirectory dir(comm,my_dofs);
+  REQUIRE (dir.is_unique());
+
+  // Also ask for a gid that nobody owns
+  auto query = all_dofs;
+  query.push_back(num_global_dofs);
+  std::vector<int> pids, lids, num_owners;
+  dir.lookup(query,pids,lids,&num_owners);
+  for (int i=0; i<num_global_dofs; ++i) {
+    REQUIRE (pids[i]==i / num_local_dofs);
+    REQUIRE (lids[i]==i % num_local_dofs);
+    REQUIRE (num_owners[i]==1);
+  }
+  REQUIRE (pids.back()==-1);
+  REQUIRE (lids.back()==-1);
+  REQUIRE (num_owners.back()==0);
+
+  // Now all ranks also own the first gid of rank 0. The lowest owner is reported.
+  const auto shared_gid = all_dofs[0];
+  if (comm.rank()>0) {
+    my_dofs.push_back(shared_gid);
+  }
+  GidDirectory dir2(comm,my_dofs);
+  REQUIRE (dir2.is_unique()==(comm.size()==1));
+  dir2.lookup(std::vector<gid_type>{shared_gid},pids,lids,&num_owners);
+  REQUIRE (pids[0]==0);
+  REQUIRE (lids[0]==0);
+  REQUIRE (num_owners[0]==comm.size());
+}
+
 } // anonymous namespace
@@ -3,9 +3,77 @@
 
 #include "cedr_bfb_tree_allreduce.hpp"
 
+#include <cstring>
+#include <map>
+
 namespace cedr {
 using mpi::Parallel;
 
+// Comm with ranks on the same node through a node-shared window. Each rank's
+// segment holds a header of flags, one per incoming on-node message, followed
+// by the rank's bd_. A sender copies its data directly into the receiver's bd_
+// at the offset the receiver would irecv into, then sets the receiver's flag to
+// the current reduction's sequence number.
+//   A sender never has to wait for the receiver to be ready. In reduction n+1,
+// a kid writes to its parent only after the parent sent the result of
+// reduction n down to it, and so after the parent is done with that slot; and
+// similarly for parent to kid.
+template <typename ES>
+struct BfbTreeAllReducer<ES>::NodeShm {
+  struct Put {
+    int node_rank; // -1 if off node
+    Int offset;    // in the receiver's bd_
+    Int flag;      // in the receiver's header
+  };
+
+  MPI_Comm comm = MPI_COMM_NULL;
+  MPI_Comm pcomm = MPI_COMM_NULL; // the reducer's comm; not owned
+  MPI_Win win = MPI_WIN_NULL;
+  int size = 0;
+  size_t header_size = 0;
+  std::vector<char*> segments;
+  // [level][mmd index]. up_* go with lvl.me (put) and lvl.kids (wait); down_*
+  // go with lvl.kids (put) and lvl.me (wait). A flag of -1 means off node.
+  std::vector<std::vector<Put> > up_put, down_put;
+  std::vector<std::vector<Int> > up_flag, down_flag;
+  long long seq = 0;
+
+  volatile long long* flags (const int node_rank) const {
+    return reinterpret_cast<volatile long long*>(segments[node_rank]);
+  }
+
+  void put (const Put& pt, const Real* src, const Int n) const {
+    Real* const dst = reinterpret_cast<Real*>(segments[pt.node_rank] + header_size);
+    std::memcpy(dst + pt.offset, src, n*sizeof(Real));
+    MPI_Win_sync(win);
+    flags(pt.node_rank)[pt.flag] = seq;
+  }
+
+  // Spin on the flag, keeping MPI progress going for the off-node messages of
+  // this level, and syncing the window so the flag's update becomes visible.
+  void wait (const int my_node_rank, const Int flag) const {
+    const auto f = flags(my_node_rank);
+    while (f[flag] < seq) {
+      MPI_Win_sync(win);
+      int pending;
+      MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, pcomm, &pending, MPI_STATUS_IGNORE);
+    }
+    // Make sure we do not read the data before the flag.
+    MPI_Win_sync(win);
+  }
+
+  ~NodeShm () {
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (finalized) return;
+    if (win != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(win);
+      MPI_Win_free(&win);
+    }
+    if (comm != MPI_COMM_NULL) MPI_Comm_free(&comm);
+  }
+};
+
 template <typename ES>
 BfbTreeAllReducer<ES>
 ::BfbTreeAllReducer (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
@@ -23,6 +91,109 @@ void BfbTreeAllReducer<ES>
   nfield_ = nfield;
 }
 
+template <typename ES>
+bool BfbTreeAllReducer<ES>
+::enable_node_shared_memory () {
+  if (shm_) return true;
+  if (bd_.size() > 0) return false;
+  const auto mpitag = tree::NodeSets::mpitag + 1;
+  const auto& ns = *ns_;
+  const auto nlvl = ns.levels.size();
+  const auto s = std::make_shared<NodeShm>();
+  s->pcomm = p_->comm();
+  MPI_Comm_split_type(p_->comm(), MPI_COMM_TYPE_SHARED, p_->rank(), MPI_INFO_NULL,
+                      &s->comm);
+  MPI_Comm_size(s->comm, &s->size);
+
+  // Node rank of each comm partner, or -1 if off node.
+  std::map<Int,int> node_rank;
+  {
+    std::vector<int> ranks, node_ranks;
+    for (const auto& lvl : ns.levels) {
+      for (const auto& mmd : lvl.me) ranks.push_back(mmd.rank);
+      for (const auto& mmd : lvl.kids) ranks.push_back(mmd.rank);
+    }
+    node_ranks.resize(ranks.size());
+    MPI_Group g, node_g;
+    MPI_Comm_group(p_->comm(), &g);
+    MPI_Comm_group(s->comm, &node_g);
+    MPI_Group_translate_ranks(g, ranks.size(), ranks.data(), node_g, node_ranks.data());
+    MPI_Group_free(&g);
+    MPI_Group_free(&node_g);
+    for (size_t i = 0; i < ranks.size(); ++i)
+      node_rank[ranks[i]] = node_ranks[i] == MPI_UNDEFINED ? -1 : node_ranks[i];
+  }
+
+  // Give a flag to each incoming on-node message.
+  Int nflag = 0;
+  s->up_flag.resize(nlvl);
+  s->down_flag.resize(nlvl);
+  for (size_t il = 0; il < nlvl; ++il) {
+    const auto& lvl = ns.levels[il];
+    for (const auto& mmd : lvl.kids)
+      s->up_flag[il].push_back(node_rank[mmd.rank] >= 0 ? nflag++ : -1);
+    for (const auto& mmd : lvl.me)
+      s->down_flag[il].push_back(node_rank[mmd.rank] >= 0 ? nflag++ : -1);
+  }
+  s->header_size = ((nflag*sizeof(long long) + 63)/64)*64;
+
+  // Tell each on-node partner where to put its messages to me. Messages between
+  // two ranks match in order: leaves to root in increasing level order, then
+  // root to leaves in decreasing level order. That is the order in which I
+  // list my receives, and the partner lists its sends.
+  std::map<Int, std::vector<Int> > mine, theirs;
+  for (size_t il = 0; il < nlvl; ++il)
+    for (size_t i = 0; i < ns.levels[il].kids.size(); ++i) {
+      const auto& mmd = ns.levels[il].kids[i];
+      if (s->up_flag[il][i] < 0) continue;
+      auto& v = mine[mmd.rank];
+      v.push_back(mmd.offset*nfield_);
+      v.push_back(s->up_flag[il][i]);
+    }
+  for (size_t il = nlvl; il > 0; --il)
+    for (size_t i = 0; i < ns.levels[il-1].me.size(); ++i) {
+      const auto& mmd = ns.levels[il-1].me[i];
+      if (s->down_flag[il-1][i] < 0) continue;
+      auto& v = mine[mmd.rank];
+      v.push_back(mmd.offset*nfield_);
+      v.push_back(s->down_flag[il-1][i]);
+    }
+  // I send as many messages to a partner as it sends to me, so mine and
+  // theirs have the same size.
+  std::vector<mpi::Request> reqs(2*mine.size());
+  Int ir = 0;
+  for (const auto& e : mine) {
+    auto& t = theirs[e.first];
+    t.resize(e.second.size());
+    mpi::irecv(*p_, t.data(), t.size(), e.first, mpitag, &reqs[ir++]);
+    mpi::isend(*p_, e.second.data(), e.second.size(), e.first, mpitag, &reqs[ir++]);
+  }
+  mpi::waitall(reqs.size(), reqs.data());
+
+  std::map<Int, size_t> pos;
+  s->up_put.resize(nlvl);
+  s->down_put.resize(nlvl);
+  const auto next = [&] (const Int rank) {
+    const int nr = node_rank[rank];
+    if (nr < 0) return typename NodeShm::Put{-1, -1, -1};
+    const auto& t = theirs[rank];
+    auto& k = pos[rank];
+    cedr_assert(k + 1 < t.size());
+    const typename NodeShm::Put pt{nr, t[k], t[k+1]};
+    k += 2;
+    return pt;
+  };
+  for (size_t il = 0; il < nlvl; ++il)
+    for (const auto& mmd : ns.levels[il].me)
+      s->up_put[il].push_back(next(mmd.rank));
+  for (size_t il = nlvl; il > 0; --il)
+    for (const auto& mmd : ns.levels[il-1].kids)
+      s->down_put[il-1].push_back(next(mmd.rank));
+
+  shm_ = s;
+  return true;
+}
+
 template <typename ES>
 void BfbTreeAllReducer<ES>
 ::get_host_buffers_sizes (size_t& buf1, size_t& buf2) {
@@ -34,6 +205,7 @@ template <typename ES>
 void BfbTreeAllReducer<ES>
 ::set_host_buffers (Real* buf1, Real* buf2) {
   if ( ! buf1) return;
+  cedr_throw_if(shm_, "BfbTreeAllReducer: host buffers cannot be set with node shared memory.");
   size_t s1, s2;
   get_host_buffers_sizes(s1, s2);
   bd_ = RealListHost(buf1, s1);
@@ -48,7 +220,121 @@ void BfbTreeAllReducer<ES>
     cedr_assert(bd_.size() == s1);
     return;
   }
-  bd_ = RealListHost("bd_", s1);
+  if ( ! shm_) {
+    bd_ = RealListHost("bd_", s1);
+    return;
+  }
+  auto& s = *shm_;
+  char* base;
+  MPI_Win_allocate_shared(s.header_size + s1*sizeof(Real), 1, MPI_INFO_NULL, s.comm,
+                          &base, &s.win);
+  s.segments.resize(s.size);
+  for (int r = 0; r < s.size; ++r) {
+    MPI_Aint sz;
+    int disp;
+    MPI_Win_shared_query(s.win, r, &sz, &disp, &s.segments[r]);
+  }
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, s.win);
+  std::memset(base, 0, s.header_size);
+  MPI_Win_sync(s.win);
+  MPI_Barrier(s.comm);
+  bd_ = RealListHost(reinterpret_cast<Real*>(base + s.header_size), s1);
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::recv_from_kids (const Int il) const {
+  const auto mpitag = tree::NodeSets::mpitag;
+  const auto nf = nfield_;
+  auto& lvl = ns_->levels[il];
+  if ( ! shm_) {
+    for (size_t i = 0; i < lvl.kids.size(); ++i) {
+      const auto& mmd = lvl.kids[i];
+      mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
+                 &lvl.kids_req[i]);
+    }
+    mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
+    return;
+  }
+  const auto& s = *shm_;
+  std::vector<mpi::Request> reqs;
+  reqs.reserve(lvl.kids.size());
+  for (size_t i = 0; i < lvl.kids.size(); ++i) {
+    if (s.up_flag[il][i] >= 0) continue;
+    const auto& mmd = lvl.kids[i];
+    reqs.emplace_back();
+    mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
+               &reqs.back());
+  }
+  int node_rank;
+  MPI_Comm_rank(s.comm, &node_rank);
+  for (size_t i = 0; i < lvl.kids.size(); ++i)
+    if (s.up_flag[il][i] >= 0) s.wait(node_rank, s.up_flag[il][i]);
+  MPI_Win_sync(s.win);
+  mpi::waitall(reqs.size(), reqs.data());
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::send_to_parents (const Int il) const {
+  const auto mpitag = tree::NodeSets::mpitag;
+  const auto nf = nfield_;
+  const auto& lvl = ns_->levels[il];
+  for (size_t i = 0; i < lvl.me.size(); ++i) {
+    const auto& mmd = lvl.me[i];
+    if (shm_ && shm_->up_put[il][i].node_rank >= 0)
+      shm_->put(shm_->up_put[il][i], &bd_[mmd.offset * nf], mmd.size * nf);
+    else
+      mpi::isend(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag);
+  }
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::recv_from_parents (const Int il) const {
+  const auto mpitag = tree::NodeSets::mpitag;
+  const auto nf = nfield_;
+  auto& lvl = ns_->levels[il];
+  if ( ! shm_) {
+    for (size_t i = 0; i < lvl.me.size(); ++i) {
+      const auto& mmd = lvl.me[i];
+      mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
+                 &lvl.me_recv_req[i]);
+    }
+    mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
+    return;
+  }
+  const auto& s = *shm_;
+  std::vector<mpi::Request> reqs;
+  reqs.reserve(lvl.me.size());
+  for (size_t i = 0; i < lvl.me.size(); ++i) {
+    if (s.down_flag[il][i] >= 0) continue;
+    const auto& mmd = lvl.me[i];
+    reqs.emplace_back();
+    mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
+               &reqs.back());
+  }
+  int node_rank;
+  MPI_Comm_rank(s.comm, &node_rank);
+  for (size_t i = 0; i < lvl.me.size(); ++i)
+    if (s.down_flag[il][i] >= 0) s.wait(node_rank, s.down_flag[il][i]);
+  MPI_Win_sync(s.win);
+  mpi::waitall(reqs.size(), reqs.data());
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::send_to_kids (const Int il) const {
+  const auto mpitag = tree::NodeSets::mpitag;
+  const auto nf = nfield_;
+  const auto& lvl = ns_->levels[il];
+  for (size_t i = 0; i < lvl.kids.size(); ++i) {
+    const auto& mmd = lvl.kids[i];
+    if (shm_ && shm_->down_put[il][i].node_rank >= 0)
+      shm_->put(shm_->down_put[il][i], &bd_[mmd.offset * nf], mmd.size * nf);
+    else
+      mpi::isend(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag);
+  }
 }
 
 template <typename ES>
@@ -78,7 +364,13 @@ void BfbTreeAllReducer<ES>
 template <typename ES>
 void BfbTreeAllReducer<ES>
 ::allreduce (const ConstRealList& send, const RealList& recv, const bool transpose) const {
-  const auto mpitag = tree::NodeSets::mpitag;
+  allreduce_start(send, transpose);
+  allreduce_finish(recv);
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::allreduce_start (const ConstRealList& send, const bool transpose) const {
   const auto& ns = *ns_;
   const auto nf = nfield_;
   cedr_assert(ns.levels[0].nodes.size() == static_cast<size_t>(nlocal_));
@@ -105,16 +397,11 @@ void BfbTreeAllReducer<ES>
       for (Int j = 0; j < nf; ++j) d[j] = s[j];
     }
   }
+  if (shm_) ++shm_->seq;
   // Leaves to root.
   for (size_t il = 0; il < ns.levels.size(); ++il) {
     auto& lvl = ns.levels[il];
-    // Set up receives.
-    for (size_t i = 0; i < lvl.kids.size(); ++i) {
-      const auto& mmd = lvl.kids[i];
-      mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
-                 &lvl.kids_req[i]);
-    }
-    mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
+    recv_from_kids(il);
     // Combine kids' data.
     for (const auto& idx : lvl.nodes) {
       const auto n = ns.node_h(idx);
@@ -126,22 +413,20 @@ void BfbTreeAllReducer<ES>
         for (Int j = 0; j < nf; ++j) d[j] += s[j];
       }
     }
-    // Send to parents.
-    for (size_t i = 0; i < lvl.me.size(); ++i) {
-      const auto& mmd = lvl.me[i];
-      mpi::isend(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag);
-    }
+    send_to_parents(il);
   }
+}
+
+template <typename ES>
+void BfbTreeAllReducer<ES>
+::allreduce_finish (const RealList& recv) const {
+  const auto& ns = *ns_;
+  const auto nf = nfield_;
   // Root to leaves.
   for (size_t il = ns.levels.size(); il > 0; --il) {
     auto& lvl = ns.levels[il-1];
     // Get the global sum from parent.
-    for (size_t i = 0; i < lvl.me.size(); ++i) {
-      const auto& mmd = lvl.me[i];
-      mpi::irecv(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag,
-                 &lvl.me_recv_req[i]);
-    }    
-    mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
+    recv_from_parents(il-1);
     // Pass to kids.
     for (const auto& idx : lvl.nodes) {
       const auto n = ns.node_h(idx);
@@ -152,11 +437,7 @@ void BfbTreeAllReducer<ES>
         for (Int j = 0; j < nf; ++j) d[j] = s[j];
       }
     }
-    // Send.
-    for (size_t i = 0; i < lvl.kids.size(); ++i) {
-      const auto& mmd = lvl.kids[i];
-      mpi::isend(*p_, &bd_[mmd.offset * nf], mmd.size * nf, mmd.rank, mpitag);
-    }
+    send_to_kids(il-1);
   }
 
   fill_recv(recv);
@@ -200,6 +481,23 @@ Int BfbTreeAllReducer<ES>::unittest (const Parallel::Ptr& p) {
           ar.allreduce(send, recv, transpose);
           Kokkos::deep_copy(recv_m, recv);
 
+          { // Going through node shared memory must give the same bits.
+            BfbTreeAllReducer<> ar_shm(p, tree, m.ncell(), nfield);
+            ar_shm.enable_node_shared_memory();
+            BfbTreeAllReducer<>::RealList recv_shm("recv_shm", nfield);
+            for (Int trial = 0; trial < 2; ++trial) {
+              ar_shm.allreduce(send, recv_shm, transpose);
+              const auto recv_shm_m = Kokkos::create_mirror_view(recv_shm);
+              Kokkos::deep_copy(recv_shm_m, recv_shm);
+              for (Int j = 0; j < nfield; ++j)
+                if (recv_shm_m(j) != recv_m(j)) {
+                  printf("FAIL BfbTreeAllReducer<>::unittest node shm\n");
+                  ++nerr;
+                  break;
+                }
+            }
+          }
+
           std::vector<Real> lcl_red(nfield, 0);
           if (transpose) {
             for (Int j = 0; j < nfield; ++j)
@@ -11,6 +11,10 @@ namespace cedr {
 // Use a tree and point-to-point communication to implement all-reduce. If the
 // tree is independent of process deomposition, then
 // BfbTreeAllReducer::allreduce is BFB-invariant to process decomposition.
+//   Optionally, tree edges between ranks on the same node go through a
+// node-shared window instead of MPI, so that only edges between nodes cost a
+// message. The tree, and thus the arithmetic, is unchanged, so the result is
+// still BFB-invariant, and identical to the MPI-only result.
 template <typename ExeSpace = Kokkos::DefaultExecutionSpace>
 struct BfbTreeAllReducer {
   typedef typename cedr::impl::DeviceType<ExeSpace>::type Device;
@@ -26,6 +30,11 @@ struct BfbTreeAllReducer {
                     // reduce.
                     const Int nleaf, const Int nfield);
 
+  // Collective over p. Call it before set_host_buffers, finish_setup, and the
+  // first allreduce. Returns false, on all ranks, if host buffers were already
+  // set; the window provides the buffer, so these cannot be used with it.
+  bool enable_node_shared_memory();
+
   // All three are optional.
   void get_host_buffers_sizes(size_t& buf1, size_t& buf2);
   void set_host_buffers(Real* buf1, Real* buf2);
@@ -40,6 +49,14 @@ struct BfbTreeAllReducer {
   void allreduce(const ConstRealList& send, const RealList& recv,
                  const bool transpose = false) const;
 
+  // allreduce split in two phases. allreduce_start runs the leaves-to-root
+  // pass; allreduce_finish runs the root-to-leaves pass and fills recv. Work
+  // that does not touch send or recv can run in between. A rank that owns only
+  // leaves just sends in allreduce_start, so it can overlap the whole
+  // reduction with that work. Only one reduction can be in flight at a time.
+  void allreduce_start(const ConstRealList& send, const bool transpose = false) const;
+  void allreduce_finish(const RealList& recv) const;
+
   static Int unittest(const mpi::Parallel::Ptr& p);
 
 private:
@@ -48,10 +65,17 @@ private:
   std::shared_ptr<const tree::NodeSets> ns_;
   mutable RealListHost bd_;
 
+  struct NodeShm;
+  std::shared_ptr<NodeShm> shm_;
+
   void init(const mpi::Parallel::Ptr& p, const tree::Node::Ptr& tree,
             const Int nleaf, const Int nfield);
   const Real* get_send_host(const ConstRealList& send) const;
   void fill_recv(const RealList& recv) const;
+  void recv_from_kids(const Int il) const;
+  void send_to_parents(const Int il) const;
+  void recv_from_parents(const Int il) const;
+  void send_to_kids(const Int il) const;
 };
 
 } // namespace cedr
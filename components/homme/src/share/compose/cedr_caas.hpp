@@ -46,6 +46,17 @@ public:
     // if those DOFs are guaranteed always to be on the same processor. If so,
     // expose that value n here.
     virtual int n_accum_in_place () const { return 1; }
+
+    // Optional nonblocking interface. start has the same arguments as
+    // operator() and begins the reduction; finish completes it, filling
+    // rcvbuf. By default, start does the whole reduction.
+    virtual int start (const mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+                       int nlocal, int nfld, MPI_Op op) const {
+      return (*this)(p, sendbuf, rcvbuf, nlocal, nfld, op);
+    }
+    virtual int finish (const mpi::Parallel& p, Real* rcvbuf, int nfld) const {
+      return 0;
+    }
   };
 
   CAAS(const mpi::Parallel::Ptr& p, const Int nlclcells,
@@ -88,6 +99,13 @@ public:
 
   void run() override;
 
+  // run_start does the local reductions and starts the global one;
+  // run_finish waits for the global reduction and then does the local
+  // adjustments. In between, the caller must not touch the data set through
+  // the DeviceOp.
+  void run_start() override;
+  void run_finish() override;
+
 protected:
   typedef cedr::impl::Unmanaged<RealList> UnmanagedRealList;
 
@@ -106,8 +124,12 @@ protected:
   RealList send_, recv_;
   bool finished_setup_;
   DeviceOp o;
+  mpi::Request reduce_req_;
+  bool reduce_pending_;
 
   void reduce_globally();
+  void reduce_globally_start();
+  void reduce_globally_finish();
 
 PRIVATE_CUDA:
   void reduce_locally();
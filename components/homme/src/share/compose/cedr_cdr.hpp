@@ -107,6 +107,12 @@ struct CDR {
   // call this function from a parallel region.
   virtual void run() = 0;
 
+  // run() split in two phases, so that the caller can do work that does not
+  // involve this object while the global communication is in flight. The
+  // default does everything in run_start.
+  virtual void run_start () { run(); }
+  virtual void run_finish () {}
+
 protected:
   Options options_;
 };
@@ -392,10 +392,13 @@ struct TreeReducer :
   typedef typename cedr::BfbTreeAllReducer<typename MT::DES> Reducer;
 
   TreeReducer (const cedr::mpi::Parallel::Ptr& p, const cedr::tree::Node::Ptr& tree,
-               Int nleaf, Int nfield, Int n_accum_in_place)
+               Int nleaf, Int nfield, Int n_accum_in_place, bool node_shm)
     : n_accum_in_place_(n_accum_in_place), nfield_(nfield),
       r_(p, tree, nleaf, nfield)
-  {}
+  {
+    // Same bits, fewer messages.
+    if (node_shm) r_.enable_node_shared_memory();
+  }
 
   virtual ~TreeReducer () {}
 
@@ -417,16 +420,38 @@ struct TreeReducer :
     return 0;
   }
 
+  int start (const cedr::mpi::Parallel& p, Real* sendbuf, Real* rcvbuf,
+             int nlocal, int count, MPI_Op op) const override {
+    cedr_assert(op == MPI_SUM);
+    cedr_assert(count == nfield_);
+#ifdef COMPOSE_HORIZ_OPENMP
+    return (*this)(p, sendbuf, rcvbuf, nlocal, count, op);
+#else
+    r_.allreduce_start(typename Reducer::ConstRealList(sendbuf, nlocal*count), true);
+    pending_ = true;
+    return 0;
+#endif
+  }
+
+  int finish (const cedr::mpi::Parallel& p, Real* rcvbuf, int count) const override {
+    if (pending_) {
+      r_.allreduce_finish(typename Reducer::RealList(rcvbuf, count));
+      pending_ = false;
+    }
+    return 0;
+  }
+
 private:
   const Int n_accum_in_place_, nfield_;
   Reducer r_;
+  mutable bool pending_ = false;
 };
 
 template <typename MT>
 CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int np_,
               Int qsize_, bool use_sgi, bool independent_time_steps,
               const bool hard_zero_, const Int* gid_data, const Int* rank_data,
-              const cedr::mpi::Parallel::Ptr& p_, Int fcomm)
+              const cedr::mpi::Parallel::Ptr& p_, Int fcomm, const bool node_shm)
   : alg(Alg::convert(cdr_alg_)),
     ncell(ngblcell_), nlclcell(nlclcell_), nlev(nlev_), np(np_), qsize(qsize_),
     nsublev(Alg::is_suplev(alg) ? nsublev_per_suplev : 1),
@@ -458,7 +483,7 @@ CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int np_,
       tree = make_tree(p, ncell, gid_data, rank_data, 1, use_sgi, false, false);
       const Int nfield = 4*qsize*(cdr_over_super_levels ? 1 : nsuplev);
       reducer = std::make_shared<TreeReducer<MT> >(p, tree, ncell, nfield,
-                                                   n_accum_in_place);
+                                                   n_accum_in_place, node_shm);
       tree = nullptr;
     } else {
       reducer = std::make_shared<ReproSumReducer<MT> >(fcomm, n_accum_in_place);
@@ -637,11 +662,11 @@ cedr_init_impl (const homme::Int fcomm, const homme::Int cdr_alg, const bool use
                 const homme::Int gbl_ncell, const homme::Int lcl_ncell,
                 const homme::Int nlev, const homme::Int np, const homme::Int qsize,
                 const bool independent_time_steps, const bool hard_zero,
-                const homme::Int, const homme::Int) {
+                const bool node_shm, const homme::Int, const homme::Int) {
   const auto p = cedr::mpi::make_parallel(MPI_Comm_f2c(fcomm));
   g_cdr = std::make_shared<homme::CDR<ko::MachineTraits> >(
     cdr_alg, gbl_ncell, lcl_ncell, nlev, np, qsize, use_sgi,
-    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm);
+    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm, node_shm);
 }
 
 extern "C" void cedr_query_bufsz (homme::Int* sendsz, homme::Int* recvsz) {
@@ -743,9 +768,13 @@ extern "C" void cedr_sl_check (const homme::Real* minq, const homme::Real* maxq,
 namespace homme {
 bool cedr_should_run () { return g_cdr->run; }
 
-void cedr_sl_run_global () {
+void cedr_sl_run_global (const bool finish) {
   homme::sl::run_global<ko::MachineTraits>(*g_cdr, *g_sl, nullptr, nullptr,
-                                           0, g_sl->ta->nelemd - 1);
+                                           0, g_sl->ta->nelemd - 1, finish);
+}
+
+void cedr_sl_run_global_finish () {
+  homme::sl::run_global_finish<ko::MachineTraits>(*g_cdr);
 }
 
 void cedr_sl_run_local (const int limiter_option) {
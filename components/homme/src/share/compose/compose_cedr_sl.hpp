@@ -47,9 +47,14 @@ struct Data {
   {}
 };
 
+// If finish is false, the CDR's global communication is left in flight, and
+// run_global_finish must be called before run_local.
 template <typename MT>
 void run_global(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
-                const Int nets, const Int nete);
+                const Int nets, const Int nete, const bool finish = true);
+
+template <typename MT>
+void run_global_finish(CDR<MT>& cdr);
 
 template <typename MT>
 void run_local(CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
@@ -41,11 +41,14 @@ COMPOSE_FUNCTION ko::EnableIfOnGpu<MT> warn_on_Qm_prev_negative (
 {}
 
 template <typename MT>
-static void run_cdr (CDR<MT>& q) {
+static void run_cdr (CDR<MT>& q, const bool finish) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
-  q.cdr->run();
+  if (finish)
+    q.cdr->run();
+  else
+    q.cdr->run_start();
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 #endif
@@ -173,7 +176,7 @@ void run_global (CDR<MT>& cdr, CDRT* cedr_cdr_p,
 
 template <typename MT>
 void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
-                 const Int nets, const Int nete) {
+                 const Int nets, const Int nete, const bool finish) {
   if (dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()))
     run_global<4, MT, typename CDR<MT>::QLTT>(
       cdr, dynamic_cast<typename CDR<MT>::QLTT*>(cdr.cdr.get()),
@@ -186,12 +189,26 @@ void run_global (CDR<MT>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r
     cedr_throw_if(true, "run_global: could not cast cdr.");
   ko::fence();
   { Timer t("02_run_cdr");
-    run_cdr(cdr); }
+    run_cdr(cdr, finish); }
+}
+
+template <typename MT>
+void run_global_finish (CDR<MT>& cdr) {
+  Timer t("02_run_cdr");
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
+  cdr.cdr->run_finish();
+#ifdef COMPOSE_HORIZ_OPENMP
+# pragma omp barrier
+#endif
 }
 
 template void
 run_global(CDR<ko::MachineTraits>& cdr, const Data& d, Real* q_min_r, const Real* q_max_r,
-           const Int nets, const Int nete);
+           const Int nets, const Int nete, const bool finish);
+
+template void run_global_finish(CDR<ko::MachineTraits>& cdr);
 
 } // namespace sl
 } // namespace homme
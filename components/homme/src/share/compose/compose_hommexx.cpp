@@ -7,7 +7,8 @@ namespace homme {
 islmpi::IslMpi<>::Ptr get_isl_mpi_singleton();
 
 bool cedr_should_run();
-void cedr_sl_run_global();
+void cedr_sl_run_global(const bool finish);
+void cedr_sl_run_global_finish();
 void cedr_sl_run_local(const int limiter_option);
 void cedr_sl_check();
 
@@ -76,10 +77,20 @@ void set_dp3d_np1 (const int np1) {
 
 bool property_preserve_global () {
   if ( ! cedr_should_run()) return false;
-  homme::cedr_sl_run_global();
+  homme::cedr_sl_run_global(true);
   return true;
 }
 
+bool property_preserve_global_start () {
+  if ( ! cedr_should_run()) return false;
+  homme::cedr_sl_run_global(false);
+  return true;
+}
+
+void property_preserve_global_finish () {
+  homme::cedr_sl_run_global_finish();
+}
+
 bool property_preserve_local (const int limiter_option) {
   if ( ! cedr_should_run()) return false;
   homme::cedr_sl_run_local(limiter_option);
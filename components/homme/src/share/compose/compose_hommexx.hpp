@@ -27,6 +27,10 @@ void advect(const int np1, const int n0_qdp, const int np1_qdp);
 
 void set_dp3d_np1(const int np1);
 bool property_preserve_global();
+// property_preserve_global split so that work independent of the tracers can
+// run while the global reduction is in flight.
+bool property_preserve_global_start();
+void property_preserve_global_finish();
 bool property_preserve_local(const int limiter_option);
 void property_preserve_check();
 
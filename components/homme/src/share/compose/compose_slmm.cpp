@@ -366,6 +366,16 @@ void slmm_init_plane (homme::Real Sx, homme::Real Sy, homme::Real Lx, homme::Rea
   homme::g_advecter->init_plane(Sx, Sy, Lx, Ly);
 }
 
+void slmm_set_adaptive_halo (const bool adaptive) {
+  slmm_assert(homme::g_csl_mpi);
+  homme::islmpi::set_adaptive_halo(*homme::g_csl_mpi, adaptive);
+}
+
+void slmm_set_q_float_comm (const bool q_float) {
+  slmm_assert(homme::g_csl_mpi);
+  homme::islmpi::set_q_float_comm(*homme::g_csl_mpi, q_float);
+}
+
 void slmm_set_bufs (homme::Real* sendbuf, homme::Real* recvbuf,
                     homme::Int, homme::Int) {
   slmm_assert(homme::g_csl_mpi);
@@ -695,6 +695,20 @@ void set_idx2_maps (IslMpi<MT>& cm, const Rank2Gids& rank2rmtgids,
     ed.q_extrema = typename IslMpi<MT>::template ArrayH<Real**[2]>(
       "q_extrema", cm.qsize, cm.nlev);
   }
+
+  // Ranks owning a cell in the 1-halo of one of my cells are near.
+  cm.near_rank_h.reset_capacity(nrmtrank, true);
+  for (Int ri = 0; ri < nrmtrank; ++ri) cm.near_rank_h(ri) = 0;
+  for (i = 0; i < cm.nelemd; ++i) {
+    const auto& ed = cm.ed_h(i);
+    for (Int ni = 0; ni < ed.nin1halo; ++ni) {
+      const auto& n = ed.nbrs(ni);
+      if (n.rank != myrank) cm.near_rank_h(n.rank_idx) = 1;
+    }
+  }
+  cm.nfar_rank = 0;
+  for (Int ri = 0; ri < nrmtrank; ++ri)
+    if ( ! cm.near_rank_h(ri)) ++cm.nfar_rank;
 }
 
 // In the original MPI pattern that has been in HOMME for years, each owned cell
@@ -771,6 +785,14 @@ void alloc_mpi_buffers (IslMpi<MT>& cm, Real* sendbuf, Real* recvbuf) {
   cm.sendbuf_h = cm.sendbuf.mirror();
   cm.recvbuf_h = cm.recvbuf.mirror();
 #endif
+  if (cm.q_float_comm) {
+    cm.sendbuf_f.init(nrmtrank, cm.sendsz.data());
+    cm.recvbuf_f.init(nrmtrank, cm.recvsz.data());
+#ifdef COMPOSE_MPI_ON_HOST
+    cm.sendbuf_f_h = cm.sendbuf_f.mirror();
+    cm.recvbuf_f_h = cm.recvbuf_f.mirror();
+#endif
+  }
   cm.nlid_per_rank.clear();
   cm.sendsz.clear();
   cm.recvsz.clear();
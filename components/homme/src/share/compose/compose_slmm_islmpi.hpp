@@ -54,6 +54,7 @@ struct Request {
 
 template <typename T> MPI_Datatype get_type();
 template <> inline MPI_Datatype get_type<int>() { return MPI_INT; }
+template <> inline MPI_Datatype get_type<float>() { return MPI_FLOAT; }
 template <> inline MPI_Datatype get_type<double>() { return MPI_DOUBLE; }
 template <> inline MPI_Datatype get_type<long>() { return MPI_LONG_INT; }
 
@@ -93,6 +94,18 @@ int all_reduce (const Parallel& p, const T* sendbuf, T* rcvbuf, int count, MPI_O
   MPI_Datatype dt = get_type<T>();
   return MPI_Allreduce(const_cast<T*>(sendbuf), rcvbuf, count, dt, op, p.comm());
 }
+
+template <typename T>
+int iall_reduce (const Parallel& p, const T* sendbuf, T* rcvbuf, int count,
+                 MPI_Op op, Request* ireq) {
+  MPI_Datatype dt = get_type<T>();
+  int ret = MPI_Iallreduce(const_cast<T*>(sendbuf), rcvbuf, count, dt, op,
+                           p.comm(), &ireq->request);
+#ifdef COMPOSE_DEBUG_MPI
+  ireq->unfreed++;
+#endif
+  return ret;
+}
 } // namespace mpi
 
 namespace islmpi {
@@ -604,6 +617,13 @@ struct IslMpi {
   ListOfLists<Real, DDT> sendbuf, recvbuf;
 #ifdef COMPOSE_MPI_ON_HOST
   typename ListOfLists<Real, DDT>::Mirror sendbuf_h, recvbuf_h;
+#endif
+  // If q_float_comm, the q messages are sent in single precision through these
+  // buffers, which have the same layout as sendbuf and recvbuf.
+  bool q_float_comm;
+  ListOfLists<float, DDT> sendbuf_f, recvbuf_f;
+#ifdef COMPOSE_MPI_ON_HOST
+  typename ListOfLists<float, DDT>::Mirror sendbuf_f_h, recvbuf_f_h;
 #endif
   FixedCapList<Int, DDT> sendcount, x_bulkdata_offset;
   ListOfLists<Real, HDT> sendbuf_meta_h, recvbuf_meta_h; // not mirrors
@@ -621,6 +641,16 @@ struct IslMpi {
   ListOfLists<omp_lock_t, HDT> ri_lidi_locks;
 #endif
 
+  // Adaptive comm pattern. near_rank_h(ri) is 1 if rank ri owns a cell in the
+  // 1-halo of one of my cells; this relation is symmetric. In adaptive mode,
+  // the departure point exchange in a step goes only to near ranks unless some
+  // rank has a departure point in a far rank's cell; see isend. Buffers are
+  // still sized for the full halo.
+  bool adaptive_halo, far_recvbuf_dirty;
+  FixedCapList<Int, HDT> near_rank_h;
+  Int nfar_rank, far_lcl, far_glbl;
+  mpi::Request far_req;
+
   // temporary work space
   std::vector<Int> nlid_per_rank, sendsz, recvsz, sendmetasz, recvmetasz;
   ArrayD<Real**> rwork;
@@ -639,7 +669,9 @@ struct IslMpi {
       np(inp), np2(np*np), nlev(inlev), qsize(iqsize), qsized(iqsized), nelemd(inelemd),
       halo(ihalo), traj_3d(itraj_3d), traj_nsubstep(itraj_nsubstep),
       dep_points_ndim(traj_3d && traj_nsubstep > 0 ? 4 : 3),
-      tracer_arrays(itracer_arrays)
+      tracer_arrays(itracer_arrays), q_float_comm(false),
+      adaptive_halo(false), far_recvbuf_dirty(true), nfar_rank(0), far_lcl(0),
+      far_glbl(1)
   {}
 
   IslMpi(const IslMpi&) = delete;
@@ -706,16 +738,26 @@ void analyze_dep_points(IslMpi<MT>& cm, const Int& nets, const Int& nete,
 
 template <typename MT>
 void init_mylid_with_comm_threaded(IslMpi<MT>& cm, const Int& nets, const Int& nete);
+// If q_float, the message is the q data from calc_rmt_q, and it is sent in
+// single precision.
 template <typename MT>
-void setup_irecv(IslMpi<MT>& cm, const bool skip_if_empty = false);
+void setup_irecv(IslMpi<MT>& cm, const bool skip_if_empty = false,
+                 const bool q_float = false);
 template <typename MT>
-void isend(IslMpi<MT>& cm, const bool want_req = true, const bool skip_if_empty = false);
+void isend(IslMpi<MT>& cm, const bool want_req = true, const bool skip_if_empty = false,
+           const bool q_float = false);
 template <typename MT>
 void recv_and_wait_on_send(IslMpi<MT>& cm);
 template <typename MT>
+void set_adaptive_halo(IslMpi<MT>& cm, const bool adaptive);
+// The setting must be the same on all ranks. Call it outside of a step; if the
+// MPI buffers are already allocated, this allocates the float ones.
+template <typename MT>
+void set_q_float_comm(IslMpi<MT>& cm, const bool q_float);
+template <typename MT>
 void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty = false);
 template <typename MT>
-void recv(IslMpi<MT>& cm, const bool skip_if_empty = false);
+void recv(IslMpi<MT>& cm, const bool skip_if_empty = false, const bool q_float = false);
 
 template <typename MT>
 void pack_dep_points_sendbuf_pass1(IslMpi<MT>& cm, const bool trajectory = false);
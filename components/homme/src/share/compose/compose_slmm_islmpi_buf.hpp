@@ -1,6 +1,9 @@
 #ifndef INCLUDE_COMPOSE_SLMM_ISLMPI_BUF_HPP
 #define INCLUDE_COMPOSE_SLMM_ISLMPI_BUF_HPP
 
+#include <cstdint>
+#include <cstring>
+
 namespace homme {
 namespace islmpi {
 
@@ -47,6 +50,21 @@ Int getbuf (Buffer& buf, const Int& os, Int& i1, Int& i2) {
   return nreal_per_2int;
 }
 
+// Round d to a float that is <= d if dir < 0 or >= d if dir > 0. Rounding is
+// monotone and maps 0 to 0; the result is at most one float ulp from d.
+SLMM_KIF float round_to_float (const double d, const int dir) {
+  float f = static_cast<float>(d);
+  if (dir < 0 ? f <= d : f >= d) return f;
+  // Move f by one ulp in direction dir.
+  std::uint32_t b;
+  std::memcpy(&b, &f, sizeof(float));
+  if (f == 0) b = dir < 0 ? 0x80000001u : 0x00000001u;
+  else if ((f > 0) == (dir > 0)) ++b; // away from 0
+  else --b;                            // toward 0
+  std::memcpy(&f, &b, sizeof(float));
+  return f;
+}
+
 } // namespace islmpi
 } // namespace homme
 
@@ -314,6 +314,8 @@ calc_v_departure (IslMpi<MT>& cm, const Int nets, const Int nete,
   analyze_dep_points(cm, nets, nete, dep_points);
   pack_dep_points_sendbuf_pass1(cm, true /* trajectory */);
   pack_dep_points_sendbuf_pass2(cm, dep_points, true /* trajectory */);
+  // Unlike in step, no work overlaps the adaptive halo's far query here, so in
+  // that mode each substep pays the latency of its all-reduce.
   isend(cm);
   recv_and_wait_on_send(cm);
   traj_calc_rmt_next_step<np>(cm, vnode);
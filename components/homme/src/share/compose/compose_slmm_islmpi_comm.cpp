@@ -1,4 +1,9 @@
 #include "compose_slmm_islmpi.hpp"
+#include "compose_slmm_islmpi_buf.hpp"
+#include "compose_test.hpp"
+
+#include <cmath>
+#include <cstdio>
 
 namespace homme {
 namespace islmpi {
@@ -38,51 +43,183 @@ void init_mylid_with_comm_threaded (IslMpi<MT>& cm, const Int& nets, const Int&
 }
 
 template <typename MT>
-void setup_irecv (IslMpi<MT>& cm, const bool skip_if_empty) {
+void irecv_rank (IslMpi<MT>& cm, const Int ri, const bool q_float = false) {
+  // The count is just the number of slots available, which can be larger than
+  // what is actually being received.
+  cm.recvreq_ri(cm.recvreq.n()) = ri;
+  cm.recvreq.inc();
+  if (q_float) {
+#ifdef COMPOSE_MPI_ON_HOST
+    auto&& recvbuf = cm.recvbuf_f_h(ri);
+#else
+    auto&& recvbuf = cm.recvbuf_f.get_h(ri);
+#endif
+    mpi::irecv(*cm.p, recvbuf.data(), recvbuf.n(), cm.ranks(ri), 42,
+               &cm.recvreq.back());
+    return;
+  }
+#ifdef COMPOSE_MPI_ON_HOST
+  auto&& recvbuf = cm.recvbuf_h(ri);
+#else
+  auto&& recvbuf = cm.recvbuf.get_h(ri);
+#endif
+  mpi::irecv(*cm.p, recvbuf.data(), recvbuf.n(), cm.ranks(ri), 42,
+             &cm.recvreq.back());
+}
+
+template <typename MT>
+void isend_rank (IslMpi<MT>& cm, const Int ri, const bool want_req,
+                 const bool q_float = false) {
+  if (q_float) {
+#ifdef COMPOSE_MPI_ON_HOST
+    auto&& sendbuf = cm.sendbuf_f_h(ri);
+    typedef typename IslMpi<MT>::template ArrayH<float*> ArrayH;
+    typedef typename IslMpi<MT>::template ArrayD<float*> ArrayD;
+    Kokkos::deep_copy(ArrayH(sendbuf.data(), cm.sendcount_h(ri)),
+                      ArrayD(cm.sendbuf_f.get_h(ri).data(), cm.sendcount_h(ri)));
+#else
+    auto&& sendbuf = cm.sendbuf_f.get_h(ri);
+#endif
+    mpi::isend(*cm.p, sendbuf.data(), cm.sendcount_h(ri),
+               cm.ranks(ri), 42, want_req ? &cm.sendreq(ri) : nullptr);
+    return;
+  }
+#ifdef COMPOSE_MPI_ON_HOST
+  auto&& sendbuf = cm.sendbuf_h(ri);
+  typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+  typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+  Kokkos::deep_copy(ArrayH(sendbuf.data(), cm.sendcount_h(ri)),
+                    ArrayD(cm.sendbuf.get_h(ri).data(), cm.sendcount_h(ri)));
+#else
+  auto&& sendbuf = cm.sendbuf.get_h(ri);
+#endif
+  mpi::isend(*cm.p, sendbuf.data(), cm.sendcount_h(ri),
+             cm.ranks(ri), 42, want_req ? &cm.sendreq(ri) : nullptr);
+}
+
+template <typename MT>
+void set_q_float_comm (IslMpi<MT>& cm, const bool q_float) {
+  cm.q_float_comm = q_float;
+  // If the MPI buffers are already allocated, give the float buffers the same
+  // layout now; otherwise, alloc_mpi_buffers does it.
+  if ( ! q_float || cm.sendbuf_f.n() >= 0 || cm.sendbuf.n() < 0) return;
+  const Int nrmtrank = cm.sendbuf.n();
+  std::vector<Int> sendsz(nrmtrank), recvsz(nrmtrank);
+  for (Int ri = 0; ri < nrmtrank; ++ri) {
+    sendsz[ri] = cm.sendbuf.get_h(ri).n();
+    recvsz[ri] = cm.recvbuf.get_h(ri).n();
+  }
+  cm.sendbuf_f.init(nrmtrank, sendsz.data());
+  cm.recvbuf_f.init(nrmtrank, recvsz.data());
+#ifdef COMPOSE_MPI_ON_HOST
+  cm.sendbuf_f_h = cm.sendbuf_f.mirror();
+  cm.recvbuf_f_h = cm.recvbuf_f.mirror();
+#endif
+}
+
+// calc_rmt_q_pass2 writes the q data directly to sendbuf_f; the receiver
+// widens it back to double here, before any further arithmetic.
+template <typename MT>
+void unpack_q_float (IslMpi<MT>& cm, const Int ri, const Int count) {
+  const auto& recvbuf = cm.recvbuf;
+  const auto& recvbuf_f = cm.recvbuf_f;
+  const auto f = COMPOSE_LAMBDA (const Int i) { recvbuf(ri,i) = recvbuf_f(ri,i); };
+  ko::parallel_for(ko::RangePolicy<typename MT::DES>(0, count), f);
+}
+
+// Make an unused slot in sendreq safe to pass to waitall.
+inline void set_null (mpi::Request& req) {
+  req.request = MPI_REQUEST_NULL;
+#ifdef COMPOSE_DEBUG_MPI
+  req.unfreed++;
+#endif
+}
+
+template <typename MT>
+void set_adaptive_halo (IslMpi<MT>& cm, const bool adaptive) {
+  // The setting must be the same on all ranks. With a 1-halo, every rank in
+  // the pattern is near, so there is nothing to prune.
+  cm.adaptive_halo = adaptive && cm.halo > 1;
+}
+
+// In adaptive mode, the departure point exchange first goes only to near
+// ranks. A departure point in a far rank's cell is possible only if the winds
+// carry it beyond the 1-halo, so all ranks agree through a small nonblocking
+// all-reduce, overlapped with calc_q_extrema, whether the far ranks are needed
+// in this step.
+template <typename MT>
+void start_far_query (IslMpi<MT>& cm) {
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  cm.far_lcl = 0;
+  for (Int ri = 0; ri < nrmtrank; ++ri)
+    if ( ! cm.near_rank_h(ri) && cm.nx_in_rank_h(ri) > 0) {
+      cm.far_lcl = 1;
+      break;
+    }
+  mpi::iall_reduce(*cm.p, &cm.far_lcl, &cm.far_glbl, 1, MPI_MAX, &cm.far_req);
+}
+
+template <typename MT>
+void finish_far_query (IslMpi<MT>& cm) {
+  mpi::wait(&cm.far_req);
+  const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+  if (cm.far_glbl) {
+    for (Int ri = 0; ri < nrmtrank; ++ri)
+      if ( ! cm.near_rank_h(ri)) irecv_rank(cm, ri);
+    for (Int ri = 0; ri < nrmtrank; ++ri)
+      if ( ! cm.near_rank_h(ri)) isend_rank(cm, ri, true);
+    cm.far_recvbuf_dirty = true;
+    return;
+  }
+  // No far rank sent anything. Make the far receive buffers read as empty
+  // messages in calc_rmt_q. They stay that way until a step uses far ranks.
+  if ( ! cm.far_recvbuf_dirty) return;
+  typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+  for (Int ri = 0; ri < nrmtrank; ++ri)
+    if ( ! cm.near_rank_h(ri))
+      Kokkos::deep_copy(ArrayD(cm.recvbuf.get_h(ri).data(), nreal_per_2int), 0);
+  cm.far_recvbuf_dirty = false;
+}
+
+template <typename MT>
+void setup_irecv (IslMpi<MT>& cm, const bool skip_if_empty, const bool q_float) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp master
 #endif
   {
     const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+    // Far ranks in adaptive mode are handled in finish_far_query.
+    const bool near_only = ! skip_if_empty && cm.adaptive_halo;
     cm.recvreq.clear();
-    for (Int ri = 0, nri = 0; ri < nrmtrank; ++ri) {
+    for (Int ri = 0; ri < nrmtrank; ++ri) {
       if (skip_if_empty && cm.nx_in_rank_h(ri) == 0) continue;
-      // The count is just the number of slots available, which can be larger
-      // than what is actually being received.
-      cm.recvreq_ri(nri++) = ri;
-      cm.recvreq.inc();
-#ifdef COMPOSE_MPI_ON_HOST
-      auto&& recvbuf = cm.recvbuf_h(ri);
-#else
-      auto&& recvbuf = cm.recvbuf.get_h(ri);
-#endif
-      mpi::irecv(*cm.p, recvbuf.data(), recvbuf.n(), cm.ranks(ri), 42,
-                 &cm.recvreq.back());
+      if (near_only && ! cm.near_rank_h(ri)) continue;
+      irecv_rank(cm, ri, q_float);
     }
   }
 }
 
 template <typename MT>
-void isend (IslMpi<MT>& cm, const bool want_req, const bool skip_if_empty) {
+void isend (IslMpi<MT>& cm, const bool want_req, const bool skip_if_empty,
+            const bool q_float) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
 # pragma omp master
 #endif
   {
     const Int nrmtrank = static_cast<Int>(cm.ranks.size()) - 1;
+    const bool near_only = ! skip_if_empty && cm.adaptive_halo;
+    if (near_only) {
+      slmm_assert(want_req);
+      start_far_query(cm);
+    }
     for (Int ri = 0; ri < nrmtrank; ++ri) {
       if (skip_if_empty && cm.sendcount_h(ri) == 0) continue;
-#ifdef COMPOSE_MPI_ON_HOST
-      auto&& sendbuf = cm.sendbuf_h(ri);
-      typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
-      typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
-      Kokkos::deep_copy(ArrayH(sendbuf.data(), cm.sendcount_h(ri)),
-                        ArrayD(cm.sendbuf.get_h(ri).data(), cm.sendcount_h(ri)));
-#else
-      auto&& sendbuf = cm.sendbuf.get_h(ri);
-#endif
-      mpi::isend(*cm.p, sendbuf.data(), cm.sendcount_h(ri),
-                 cm.ranks(ri), 42, want_req ? &cm.sendreq(ri) : nullptr);
+      if (near_only && ! cm.near_rank_h(ri)) {
+        set_null(cm.sendreq(ri));
+        continue;
+      }
+      isend_rank(cm, ri, want_req, q_float);
     }
   }
 }
@@ -104,10 +241,13 @@ void wait_on_send (IslMpi<MT>& cm, const bool skip_if_empty) {
 }
 
 template <typename MT>
-void wait_on_recv (IslMpi<MT>& cm) {
-#ifdef COMPOSE_MPI_ON_HOST
-  typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
-  typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
+void wait_on_recv (IslMpi<MT>& cm, const bool q_float = false) {
+#ifndef COMPOSE_MPI_ON_HOST
+  if ( ! q_float) {
+    mpi::waitall(cm.recvreq.n(), cm.recvreq.data());
+    return;
+  }
+#endif
   const int nreq = cm.recvreq.n();
   for (Int i = 0; i < nreq; ++i) {
     Int reqi;
@@ -115,13 +255,26 @@ void wait_on_recv (IslMpi<MT>& cm) {
     mpi::waitany(nreq, cm.recvreq.data(), &reqi, &stat);
     const Int ri = cm.recvreq_ri(reqi);
     int count;
+    if (q_float) {
+      MPI_Get_count(&stat, mpi::get_type<float>(), &count);
+#ifdef COMPOSE_MPI_ON_HOST
+      typedef typename IslMpi<MT>::template ArrayH<float*> ArrayH;
+      typedef typename IslMpi<MT>::template ArrayD<float*> ArrayD;
+      Kokkos::deep_copy(ArrayD(cm.recvbuf_f.get_h(ri).data(), count),
+                        ArrayH(cm.recvbuf_f_h(ri).data(), count));
+#endif
+      unpack_q_float(cm, ri, count);
+      continue;
+    }
+#ifdef COMPOSE_MPI_ON_HOST
+    typedef typename IslMpi<MT>::template ArrayH<Real*> ArrayH;
+    typedef typename IslMpi<MT>::template ArrayD<Real*> ArrayD;
     MPI_Get_count(&stat, mpi::get_type<Real>(), &count);
     Kokkos::deep_copy(ArrayD(cm.recvbuf.get_h(ri).data(), count),
                       ArrayH(cm.recvbuf_h(ri).data(), count));
-  }
-#else
-  mpi::waitall(cm.recvreq.n(), cm.recvreq.data());
 #endif
+  }
+  if (q_float) ko::fence();
 }
 
 template <typename MT>
@@ -130,6 +283,7 @@ void recv_and_wait_on_send (IslMpi<MT>& cm) {
 # pragma omp master
 #endif
   {
+    if (cm.adaptive_halo) finish_far_query(cm);
     mpi::waitall(cm.sendreq.n(), cm.sendreq.data());
     wait_on_recv(cm);
   }
@@ -139,12 +293,12 @@ void recv_and_wait_on_send (IslMpi<MT>& cm) {
 }
 
 template <typename MT>
-void recv (IslMpi<MT>& cm, const bool skip_if_empty) {
+void recv (IslMpi<MT>& cm, const bool skip_if_empty, const bool q_float) {
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp master
 #endif
   {
-    wait_on_recv(cm);
+    wait_on_recv(cm, q_float);
   }
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp barrier
@@ -153,12 +307,48 @@ void recv (IslMpi<MT>& cm, const bool skip_if_empty) {
 
 template void init_mylid_with_comm_threaded(
   IslMpi<ko::MachineTraits>& cm, const Int& nets, const Int& nete);
-template void setup_irecv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
+template void setup_irecv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty,
+                          const bool q_float);
 template void isend(IslMpi<ko::MachineTraits>& cm, const bool want_req,
-                    const bool skip_if_empty);
+                    const bool skip_if_empty, const bool q_float);
 template void recv_and_wait_on_send(IslMpi<ko::MachineTraits>& cm);
+template void set_adaptive_halo(IslMpi<ko::MachineTraits>& cm, const bool adaptive);
+template void set_q_float_comm(IslMpi<ko::MachineTraits>& cm, const bool q_float);
 template void wait_on_send(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
-template void recv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty);
+template void recv(IslMpi<ko::MachineTraits>& cm, const bool skip_if_empty,
+                   const bool q_float);
 
 } // namespace islmpi
 } // namespace homme
+
+namespace compose {
+namespace test {
+
+// The q extrema are sent rounded outward, and the q values rounded to nearest,
+// so the bounds the receiver sees must contain both the double values and the
+// float q values.
+int islmpi_q_float_unittest () {
+  using homme::islmpi::round_to_float;
+  int nerr = 0;
+  const auto check = [&] (const double d) {
+    const float lo = round_to_float(d, -1), hi = round_to_float(d, 1);
+    const float f = static_cast<float>(d);
+    if (lo > d || hi < d) ++nerr;
+    if (f < lo || f > hi) ++nerr;
+    // At most one ulp apart, and exact if d is a float.
+    if (lo == d ? hi != d : std::nextafter(lo, HUGE_VALF) != hi) ++nerr;
+    // Nonnegativity and nonpositivity are preserved.
+    if ((d >= 0 && lo < 0) || (d <= 0 && hi > 0)) ++nerr;
+  };
+  check(0);
+  const double ms[] = {1, 1 + 1e-12, 1.0/3, 0.7, 1 - 1e-12, 0.999999999};
+  for (int e = -140; e <= 126; ++e)
+    for (const double m : ms)
+      for (const double sgn : {-1.0, 1.0})
+        check(sgn*std::ldexp(m, e));
+  if (nerr) fprintf(stderr, "FAIL islmpi_q_float_unittest: nerr %d\n", nerr);
+  return nerr;
+}
+
+} // namespace test
+} // namespace compose
@@ -128,6 +128,7 @@ void copy_q (IslMpi<MT>& cm, const Int& nets,
 template <Int np, typename MT>
 void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
   const Int qsize = cm.qsize;
+  const bool q_float = cm.q_float_comm;
 
 #ifdef COMPOSE_HORIZ_OPENMP
 # pragma omp for
@@ -140,7 +141,11 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
     const auto& ed = cm.ed_h(lid);
     for (Int iq = 0; iq < qsize; ++iq)
       for (int i = 0; i < 2; ++i)
-        qs(qos + 2*iq + i) = ed.q_extrema(iq, lev, i);
+        if (q_float)
+          cm.sendbuf_f(ri, qos + 2*iq + i) =
+            round_to_float(ed.q_extrema(iq, lev, i), i == 0 ? -1 : 1);
+        else
+          qs(qos + 2*iq + i) = ed.q_extrema(iq, lev, i);
   }
 
 #ifdef COMPOSE_HORIZ_OPENMP
@@ -152,7 +157,11 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
       xos = cm.rmt_xs_h(5*it + 3), qos = qsize*cm.rmt_xs_h(5*it + 4);
     const auto&& xs = cm.recvbuf(ri);
     auto&& qs = cm.sendbuf(ri);
+    // Interpolate in double; with q_float, round only the final values.
     calc_q<np>(cm, lid, lev, &xs(xos), &qs(qos), true);
+    if (q_float)
+      for (Int iq = 0; iq < qsize; ++iq)
+        cm.sendbuf_f(ri, qos + iq) = qs(qos + iq);
   }
 }
 
@@ -352,15 +361,29 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
   const auto& rmt_xs = cm.rmt_xs;
   const auto& ed_d = cm.ed_d;
   const auto& sendbuf = cm.sendbuf;
+  const auto& sendbuf_f = cm.sendbuf_f;
   const auto& recvbuf = cm.recvbuf;
   const Int qsize = cm.qsize;
+  // With q_float_comm, write the q data in single precision directly to
+  // sendbuf_f. The extrema are rounded outward, so the bounds the receiver sees
+  // never exclude the values they bound; the q values are interpolated in
+  // double and rounded to nearest only when stored.
+  const bool q_float = cm.q_float_comm;
 
   const auto fqe = COMPOSE_LAMBDA (const Int& it) {
     const Int
     ri = rmt_qs_extrema(4*it), lid = rmt_qs_extrema(4*it + 1),
     lev = rmt_qs_extrema(4*it + 2), qos = qsize*rmt_qs_extrema(4*it + 3);  
-    auto&& qs = sendbuf(ri);
     const auto& ed = ed_d(lid);
+    if (q_float) {
+      auto&& qs = sendbuf_f(ri);
+      for (Int iq = 0; iq < qsize; ++iq) {
+        qs(qos + 2*iq    ) = round_to_float(ed.q_extrema(iq, lev, 0), -1);
+        qs(qos + 2*iq + 1) = round_to_float(ed.q_extrema(iq, lev, 1),  1);
+      }
+      return;
+    }
+    auto&& qs = sendbuf(ri);
     for (Int iq = 0; iq < qsize; ++iq)
       for (int i = 0; i < 2; ++i)
         qs(qos + 2*iq + i) = ed.q_extrema(iq, lev, i);
@@ -378,10 +401,10 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
     ri = rmt_xs(5*it), lid = rmt_xs(5*it + 1), lev = rmt_xs(5*it + 2),
     xos = rmt_xs(5*it + 3), qos = qsize*rmt_xs(5*it + 4);
     const auto&& xs = recvbuf(ri);
-    auto&& qs = sendbuf(ri);
     Real rx[4], ry[4];
     calc_coefs<np,MT>(s2r, local_meshes(lid), alg, lid, lev, &xs(xos), rx, ry);
-    Real* const q_tgt = &qs(qos);
+    Real* const q_tgt = q_float ? nullptr : &sendbuf(ri, qos);
+    float* const q_tgt_f = q_float ? &sendbuf_f(ri, qos) : nullptr;
     // Block for auto-vectorization.
     for (Int iqo = 0; iqo < qsize; iqo += blocksize) {
       if (iqo + blocksize <= qsize) {
@@ -392,13 +415,19 @@ void calc_rmt_q_pass2 (IslMpi<MT>& cm) {
           for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq, k, lev);
           tmp[iqi] = calc_q_tgt(rx, ry, qsrc);
         }
-        for (Int iqi = 0; iqi < blocksize; ++iqi)
-          q_tgt[iqo + iqi] = tmp[iqi];
+        if (q_float)
+          for (Int iqi = 0; iqi < blocksize; ++iqi)
+            q_tgt_f[iqo + iqi] = tmp[iqi];
+        else
+          for (Int iqi = 0; iqi < blocksize; ++iqi)
+            q_tgt[iqo + iqi] = tmp[iqi];
       } else {
         for (Int iq = iqo; iq < qsize; ++iq) {
           Real qsrc[16];
           for (Int k = 0; k < 16; ++k) qsrc[k] = q_src(lid, iq, k, lev);
-          q_tgt[iq] = calc_q_tgt(rx, ry, qsrc);
+          const Real q = calc_q_tgt(rx, ry, qsrc);
+          if (q_float) q_tgt_f[iq] = q;
+          else q_tgt[iq] = q;
         }
       }
     }
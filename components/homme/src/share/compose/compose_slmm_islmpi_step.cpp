@@ -37,7 +37,8 @@ void step (
   { Timer t("01_mylid");
     if (cm.mylid_with_comm_tid_ptr_h.capacity() == 0)
       init_mylid_with_comm_threaded(cm, nets, nete); }
-  // Set up to receive departure point requests from remotes.
+  // Set up to receive departure point requests from remotes. In adaptive halo
+  // mode, this is just the near remotes; see finish_far_query.
   { Timer t("02_setup_irecv");
     setup_irecv(cm); }
   // Determine where my departure points are, and set up requests to remotes as
@@ -62,19 +63,19 @@ void step (
   calc_rmt_q(cm);
   // Send q data.
   { Timer t("10_isend");
-    isend(cm, true /* want_req */, true /* skip_if_empty */); }
+    isend(cm, true /* want_req */, true /* skip_if_empty */, cm.q_float_comm); }
   // Set up to receive q for each of my departure point requests sent to
   // remotes. We can't do this until the OpenMP barrier in isend assures that
   // all threads are done with the receive buffer's departure points.
   { Timer t("11_setup_irecv");
-    setup_irecv(cm, true /* skip_if_empty */); }
+    setup_irecv(cm, true /* skip_if_empty */, cm.q_float_comm); }
   // While waiting to get my data from remotes, compute q for departure points
   // that have remained in my elements.
   { Timer t("12_own_q");
     calc_own_q(cm, nets, nete, dep_points, q_min, q_max); }
   // Receive remote q data and use this to fill in the rest of my fields.
   { Timer t("13_recv");
-    recv(cm, true /* skip_if_empty */); }
+    recv(cm, true /* skip_if_empty */, cm.q_float_comm); }
   { Timer t("14_copy_q");
     copy_q(cm, nets, q_min, q_max); }
   // Wait on send buffer so it's free to be used by others.
@@ -14,6 +14,7 @@ int slmm_unittest();
 int cedr_unittest();
 int cedr_unittest(MPI_Comm comm);
 int interpolate_unittest();
+int islmpi_q_float_unittest();
 
 typedef double Real;
 typedef int Int;
@@ -156,6 +156,7 @@ void ComposeTransportImpl::init_boundary_exchanges () {
     auto be = m_qdp_dss_be[i];
     be->set_label(std::string("ComposeTransport-qdp-DSS-" + std::to_string(i)));
     be->set_diagnostics_level(sp.internal_diagnostics_level);
+    be->set_progressive_unpack(sp.bndry_exchange_progressive_unpack);
     be->set_buffers_manager(bm_exchange);
     be->set_num_fields(0, 0, m_data.qsize + 1);
     be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
@@ -169,6 +170,7 @@ void ComposeTransportImpl::init_boundary_exchanges () {
       auto be = m_v_dss_be[i];
       be->set_label(std::string("ComposeTransport-v-DSS-" + std::to_string(i)));
       be->set_diagnostics_level(sp.internal_diagnostics_level);
+      be->set_progressive_unpack(sp.bndry_exchange_progressive_unpack);
       be->set_buffers_manager(bm_exchange);
       be->set_num_fields(0, 0, 2+i);
       be->register_field(m_derived.m_vstar, 2, 0);
@@ -181,6 +183,7 @@ void ComposeTransportImpl::init_boundary_exchanges () {
       auto be = m_v_dss_be[i];
       be->set_label(std::string("ComposeTransport-v-DSS-" + std::to_string(i)));
       be->set_diagnostics_level(sp.internal_diagnostics_level);
+      be->set_progressive_unpack(sp.bndry_exchange_progressive_unpack);
       be->set_buffers_manager(bm_exchange);
       be->set_num_fields(0, 0, 3+i);
       be->register_field(m_tracers.qtens_biharmonic, 3+i, 0);
@@ -195,6 +198,7 @@ void ComposeTransportImpl::init_boundary_exchanges () {
       auto be = m_hv_dss_be[i];
       be->set_label(std::string("ComposeTransport-q-HV-" + std::to_string(i)));
       be->set_diagnostics_level(sp.internal_diagnostics_level);
+      be->set_progressive_unpack(sp.bndry_exchange_progressive_unpack);
       be->set_buffers_manager(bm_exchange);
       be->set_num_fields(0, 0, m_data.hv_q);
       if (i == 0) 
@@ -230,8 +234,23 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   homme::compose::set_dp3d_np1(m_data.independent_time_steps ?
                                0 : // dp3d is actually divdp
                                tl.np1);
-  const auto run_cedr = homme::compose::property_preserve_global();
-  if (run_cedr) Kokkos::fence();
+  const auto run_cedr = homme::compose::property_preserve_global_start();
+  {
+    // omega does not depend on the tracers, so prescale it for the DSS while
+    // the global reduction is in flight.
+    const auto omega = m_derived.m_omega_p;
+    const auto spheremp = m_geometry.m_spheremp;
+    const auto f = KOKKOS_LAMBDA (const int idx) {
+      int ie, i, j, lev;
+      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
+      omega(ie,i,j,lev) *= spheremp(ie,i,j);
+    };
+    launch_ie_ij_nlev<num_lev_pack>(f);
+  }
+  if (run_cedr) {
+    homme::compose::property_preserve_global_finish();
+    Kokkos::fence();
+  }
   GPTLstop("compose_cedr_global");
   GPTLstart("compose_cedr_local");
   if (run_cedr) {
@@ -269,13 +288,7 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
       qdp(ie,np1_qdp,q,i,j,lev) *= spheremp(ie,i,j);
     };
     launch_ie_q_ij_nlev<num_lev_pack>(qsize, f1);
-    const auto omega = m_derived.m_omega_p;
-    const auto f2 = KOKKOS_LAMBDA (const int idx) {
-      int ie, i, j, lev;
-      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
-      omega(ie,i,j,lev) *= spheremp(ie,i,j);
-    };
-    launch_ie_ij_nlev<num_lev_pack>(f2);
+    // omega was prescaled above.
     m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
     Kokkos::fence();
     GPTLstop("compose_dss_q");
@@ -108,9 +108,17 @@ class EulerStepFunctorImpl {
 
   bool                m_kernel_will_run_limiters;
 
+  // If true, the tracer phase of advect_and_limit runs on boundary elements
+  // first, and on interior elements while the qdp DSS messages are in flight.
+  bool                m_bndry_exchange_overlap = false;
+  // Elements processed by the tracer phase (all, unless overlapping)
+  ElementSubset       m_elems;
+
   ThreadPreferences m_tpref;
 
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
+  // m_mmqb_be and m_mm_be fused in one exchange (if fusible)
+  std::shared_ptr<BoundaryExchange> m_mmqb_mm_be;
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, 3*Q_NUM_TIME_LEVELS> m_bes;
 
   enum { m_mem_per_team = 2 * NP * NP * sizeof(Real) };
@@ -165,6 +173,7 @@ public:
     m_data.nu_p = params.nu_p;
     m_data.nu_q = params.nu_q;
     m_data.consthv = (params.hypervis_scaling == 0);
+    m_bndry_exchange_overlap = params.bndry_exchange_overlap;
 
     if (m_data.limiter_option == 4) {
       std::string msg = "[EulerStepFunctorImpl::reset]:";
@@ -271,6 +280,20 @@ public:
       be.register_min_max_fields(m_tracers.qlim, m_data.qsize, 0);
       be.registration_completed();
     }
+
+    // The min/max and the biharmonic exchanges are in flight at the same time,
+    // so send them in one message per neighbor.
+    m_mmqb_mm_be = nullptr;
+    if (BoundaryExchange::are_fusible({m_mmqb_be, m_mm_be})) {
+      m_mmqb_mm_be = BoundaryExchange::fuse({m_mmqb_be, m_mm_be}, bm_exchange);
+    }
+
+    // Visit the boundary elements first to overlap the exchange, or else follow
+    // the SFC order, if any (see Connectivity::set_elem_order_sfc)
+    const auto& connectivity = Context::singleton().get<Connectivity>();
+    m_elems.order = (m_bndry_exchange_overlap ?
+                     connectivity.get_d_elem_order() :
+                     connectivity.get_d_elem_traversal());
   }
 
   static size_t limiter_team_shmem_size (const int team_size) {
@@ -434,6 +457,32 @@ public:
     profiling_pause();
   }
 
+  // Same as advect_and_limit followed by exchange_qdp_dss_var, but the tracer
+  // phase is run on the boundary elements first, and then on the interior
+  // elements while the DSS messages are in flight. The setup phase updates the
+  // DSS variable, so it runs on all elements before the exchange starts.
+  void advect_and_limit_and_exchange() {
+    profiling_resume();
+    Kokkos::parallel_for(
+      Homme::get_default_team_policy<ExecSpace, AALSetupPhase>(
+        m_geometry.num_elems(), m_tpref),
+      *this);
+    Kokkos::fence();
+    m_kernel_will_run_limiters = true;
+    const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
+    m_bes[idx]->exchange_overlapped([&] (const int first, const int count) {
+        m_elems.offset = first;
+        Kokkos::parallel_for(
+          Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
+            count * m_data.qsize, m_tpref),
+          *this);
+        Kokkos::fence();
+      }, m_geometry.m_rspheremp);
+    m_elems.offset = 0;
+    m_kernel_will_run_limiters = false;
+    profiling_pause();
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALSetupPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu_ne);
@@ -443,6 +492,7 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALTracerPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    kv.ie = m_elems(kv.ie);
     run_tracer_phase(kv);
   }
 
@@ -588,6 +638,13 @@ public:
   }
 
   void minmax_and_biharmonic() {
+    if (m_mmqb_mm_be) {
+      // qlim is not touched by compute_biharmonic_pre
+      compute_biharmonic_pre();
+      m_mmqb_mm_be->exchange(m_geometry.m_rspheremp);
+      compute_biharmonic_post();
+      return;
+    }
     neighbor_minmax_start();
     compute_biharmonic_pre();
     m_mmqb_be->exchange(m_geometry.m_rspheremp);
@@ -653,10 +710,16 @@ public:
       }
     }
 
-    GPTLstart("tl-at adv-n-limit");
-    advect_and_limit();
-    GPTLstop("tl-at adv-n-limit");
-    exchange_qdp_dss_var();
+    if (m_bndry_exchange_overlap) {
+      GPTLstart("tl-at adv-n-limit+bexch");
+      advect_and_limit_and_exchange();
+      GPTLstop("tl-at adv-n-limit+bexch");
+    } else {
+      GPTLstart("tl-at adv-n-limit");
+      advect_and_limit();
+      GPTLstop("tl-at adv-n-limit");
+      exchange_qdp_dss_var();
+    }
   }
 
 private:
@@ -144,6 +144,21 @@ public:
   const TeamUtils<ExecSpace>* team_utils;
 }; // KernelVariables
 
+// Maps a kernel's league element index to a local element id. With an empty
+// order (the default) this is the identity. When overlapping a boundary
+// exchange with computation (see BoundaryExchange::exchange_overlapped), a
+// kernel runs on the elements order(offset:offset+league_size-1), with order
+// given by Connectivity::get_d_elem_order.
+struct ElementSubset {
+  ExecViewUnmanaged<const int*> order;
+  int offset = 0;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator() (const int idx) const {
+    return order.size()==0 ? idx : order(offset+idx);
+  }
+};
+
 } // Homme
 
 #endif // KERNEL_VARIABLES_HPP
@@ -290,7 +290,11 @@ struct RemapFunctor : public Remapper {
 
   RemapType m_remap;
 
-  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr;
+  // ComputeRemapTag teams remap m_nvar_per_team consecutive variables of one
+  // element, so the element's grid data are loaded once for all of them.
+  int m_nvar_per_team, m_nbatch;
+
+  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr, m_tu_ne_nbr;
 
   explicit
   RemapFunctor (const int qsize,
@@ -308,10 +312,13 @@ struct RemapFunctor : public Remapper {
    , m_hvcoord(hvcoord)
    , m_qdp(tracers.qdp)
    , m_remap(elements.num_elems(), m_data.capacity)
+   , m_nvar_per_team(nvar_per_team(m_state.num_elems(), num_to_remap()))
+   , m_nbatch((num_to_remap() + m_nvar_per_team - 1) / m_nvar_per_team)
    // Functor tags are irrelevant below
    , m_tu_ne(remap_team_policy<ComputeThicknessTag>(m_state.num_elems()))
    , m_tu_ne_nsr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_fields_provider.num_states_remap()))
    , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_to_remap()))
+   , m_tu_ne_nbr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_nbatch))
   {
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
@@ -412,13 +419,15 @@ struct RemapFunctor : public Remapper {
   // This asserts if num_to_remap() == 0
   KOKKOS_INLINE_FUNCTION
   void operator()(ComputeRemapTag, const TeamMember &team) const {
-    KernelVariables kv(team, m_tu_ne_ntr);
+    KernelVariables kv(team, m_tu_ne_nbr);
     assert(num_to_remap() != 0);
-    const int var = kv.ie % num_to_remap();
-    kv.ie /= num_to_remap();
+    const int ib = kv.ie % m_nbatch;
+    kv.ie /= m_nbatch;
     assert(kv.ie < m_state.num_elems());
 
-    this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    const int var_end = min((ib + 1)*m_nvar_per_team, num_to_remap());
+    for (int var = ib*m_nvar_per_team; var < var_end; ++var)
+      this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -474,7 +483,7 @@ struct RemapFunctor : public Remapper {
       run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
                                    m_state.num_elems());
       run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+                                   m_state.num_elems() * m_nbatch);
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
@@ -547,6 +556,20 @@ struct RemapFunctor : public Remapper {
   }
 
 private:
+  // On the GPU, use one team per (element, variable) pair for parallelism. On
+  // the CPU, give each team several of an element's variables, while keeping
+  // at least teams_per_thread teams per thread so the dynamic schedule can
+  // balance the load. The variables are split evenly among an element's teams.
+  static int nvar_per_team (const int num_elems, const int nvar) {
+    if (OnGpu<ExecSpace>::value || nvar <= 1) return 1;
+    constexpr int teams_per_thread = 4;
+    const int nthr = std::max(1, ExecSpace().concurrency());
+    const int max_per_team = (num_elems*nvar)/(teams_per_thread*nthr);
+    if (max_per_team <= 1) return 1;
+    const int nbatch = (nvar + max_per_team - 1)/std::min(nvar, max_per_team);
+    return (nvar + nbatch - 1)/nbatch;
+  }
+
   template <typename FunctorTag>
   typename std::enable_if<OnGpu<ExecSpace>::value == false,
                           Kokkos::TeamPolicy<ExecSpace, FunctorTag> >::type
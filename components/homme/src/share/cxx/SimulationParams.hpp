@@ -69,6 +69,23 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // If true, functors that exchange right after a full-element kernel compute
+  // the boundary elements first, and overlap the exchange of their data with
+  // the computation on the interior elements.
+  bool      bndry_exchange_overlap = false;
+
+  // If true, boundary exchanges write the data for neighbors on the same node
+  // directly into their receive buffers, placed in a node-shared memory window.
+  bool      bndry_exchange_shm = false;
+
+  // If true, boundary exchanges unpack each element as soon as the messages it
+  // depends on have arrived (see BoundaryExchange::set_progressive_unpack).
+  bool      bndry_exchange_progressive_unpack = false;
+
+  // If true, kernels visit the local elements along a space-filling curve
+  // through the element centers (see Connectivity::set_elem_order_sfc).
+  bool      elem_sfc_order = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +130,10 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   bndry_exchange_overlap: " << (bndry_exchange_overlap ? "yes" : "no") << "\n";
+  out << "   bndry_exchange_shm: " << (bndry_exchange_shm ? "yes" : "no") << "\n";
+  out << "   bndry_exchange_progressive_unpack: " << (bndry_exchange_progressive_unpack ? "yes" : "no") << "\n";
+  out << "   elem_sfc_order: " << (elem_sfc_order ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
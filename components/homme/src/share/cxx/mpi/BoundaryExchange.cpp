@@ -12,6 +12,8 @@
 
 #include "utilities/VectorUtils.hpp"
 
+#include <algorithm>
+
 #ifndef HOMME_BE_NO_HASHER
 // It's convenient and clean to use boundary exchanges as the place to hash
 // state. However, this interferes with the BoundaryExchange unit test's
@@ -61,6 +63,11 @@ BoundaryExchange::BoundaryExchange()
   m_recv_pending = false;
 
   m_diagnostics_level = 0;
+
+  m_progressive_unpack = false;
+  m_num_local_only_elems = 0;
+  m_local_pack_pending = false;
+  m_fused = false;
 }
 
 BoundaryExchange::BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager)
@@ -90,6 +97,13 @@ void BoundaryExchange::set_label (const std::string& label) { m_label = label; }
 const std::string& BoundaryExchange::get_label () const { return m_label; }
 void BoundaryExchange::set_diagnostics_level (const int level) { m_diagnostics_level = level; }
 
+void BoundaryExchange::set_progressive_unpack (const bool progressive)
+{
+  // Do not switch strategy in the middle of an exchange
+  assert (!m_send_pending && !m_recv_pending);
+  m_progressive_unpack = progressive;
+}
+
 void BoundaryExchange::set_connectivity (std::shared_ptr<Connectivity> connectivity)
 {
   // Functionality only available before registration starts
@@ -152,7 +166,8 @@ void BoundaryExchange::set_num_fields (const int num_1d_fields, const int num_2d
   assert (m_connectivity && m_connectivity->is_initialized());
 
   // We strongly advocate for not using the same BE object for both 'standard' exchange and min/max exchange
-  assert (!(num_1d_fields>0 && (num_2d_fields>0 || num_3d_fields>0 || num_3d_int_fields>0)));
+  // (unless the two are fused, see fuse)
+  assert (m_fused || !(num_1d_fields>0 && (num_2d_fields>0 || num_3d_fields>0 || num_3d_int_fields>0)));
 
   // Note: we do not set m_num_1d_fields, m_num_2d_fields and m_num_3d_fields, since we will use them as
   //       progressive indices while adding fields. Then, during registration_completed,
@@ -233,8 +248,10 @@ void BoundaryExchange::registration_completed()
   m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
   m_elem_buf_size[etoi(ConnectionKind::EDGE)]   = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * NP;
 
-  // Determine what kind of BE is this (exchange or exchange_min_max)
-  m_exchange_type = m_num_1d_fields>0 ? MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
+  // Determine what kind of BE is this (exchange or exchange_min_max). A fused BE
+  // with both kinds of fields does a standard exchange.
+  m_exchange_type = (m_num_1d_fields>0 && m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) ?
+                    MPI_EXCHANGE_MIN_MAX : MPI_EXCHANGE;
 
   // Finalize bookkeeping for any exchange on fewer than NUM_LEV levels.
   {
@@ -360,12 +377,42 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 }
 
+static void pack_min_max (
+  const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+  const ExecViewUnmanaged<const int*> ucon_ptr,
+  const ExecViewUnmanaged<ExecViewManaged<Scalar[2][NUM_LEV]>**> fields_1d,
+  const ExecViewUnmanaged<ExecViewUnmanaged<Scalar[2][NUM_LEV]>**> send_1d_buffers,
+  const int num_elems, const int num_1d_fields);
+static void unpack_min_max (
+  const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
+  const ExecViewUnmanaged<const int*> ucon_ptr,
+  const ExecViewUnmanaged<ExecViewManaged<Scalar[2][NUM_LEV]>**> fields_1d,
+  const ExecViewUnmanaged<ExecViewUnmanaged<Scalar[2][NUM_LEV]>**> recv_1d_buffers,
+  const int num_elems, const int num_1d_fields);
+
+// Map the idx-th element visited by a pack or unpack kernel to its local id. An
+// empty list means all elements, in their natural order.
+KOKKOS_INLINE_FUNCTION
+static int elem_id (const ExecViewUnmanaged<const int*>& elems, const int idx) {
+  return elems.size()==0 ? idx : elems(idx);
+}
+
+// Whether a connection with the given sharing is packed when packing the
+// connections of type pack_sharing (ANY, SHARED, or LOCAL). MISSING connections
+// are packed together with the LOCAL ones.
+KOKKOS_INLINE_FUNCTION
+static bool pack_conn (const int conn_sharing, const int pack_sharing) {
+  return (pack_sharing == etoi(ConnectionSharing::ANY) ||
+          ((conn_sharing == etoi(ConnectionSharing::SHARED)) ==
+           (pack_sharing == etoi(ConnectionSharing::SHARED))));
+}
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int pack_sharing, const int num_elems, const int num_2d_fields) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +421,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if ( ! pack_conn(info.sharing, pack_sharing)) return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -390,8 +438,9 @@ static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
+      const ExecViewUnmanaged<const int*> elems,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const int pack_sharing, const int num_elems, const int num_3d_fields,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -411,6 +460,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if ( ! pack_conn(info.sharing, pack_sharing)) return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -434,7 +484,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
     Kokkos::parallel_for(policy,
       KOKKOS_LAMBDA(const TeamMember& team) {
         Homme::KernelVariables kv(team, num_3d_fields);
-        const int ie = kv.ie;
+        const int ie = elem_id(elems, kv.ie);
         const int ifield = kv.iq;
         const auto tvr = Kokkos::ThreadVectorRange(
           kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
@@ -442,6 +492,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if ( ! pack_conn(info.sharing, pack_sharing)) continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -462,6 +513,63 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 }
 
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send(ConnectionSharing::ANY);
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  // Start receiving right away: the remote data may arrive while we are still
+  // computing the interior elements
+  if (!m_recv_pending) {
+    if ( ! m_recv_requests.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                              m_connectivity->get_comm().mpi_comm());
+    m_recv_pending = true;
+  }
+
+  pack_and_send(ConnectionSharing::SHARED);
+  // Note: pack_and_send is a no-op if there are no fields
+  m_local_pack_pending = m_send_pending;
+}
+
+void BoundaryExchange::pack_local ()
+{
+  if (!m_local_pack_pending) {
+    // Nothing was sent, since there are no fields
+    assert (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0);
+    return;
+  }
+
+  tstart("be pack_local");
+
+  pack_fields(ConnectionSharing::LOCAL);
+  Kokkos::fence();
+
+  m_local_pack_pending = false;
+  tstop("be pack_local");
+}
+
+void BoundaryExchange::finish_overlapped_exchange (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  pack_local();
+  recv_and_unpack(rspheremp);
+
+#ifndef HOMME_BE_NO_HASHER
+  if (m_diagnostics_level > 0)
+    Homme::print_global_state_hash(std::string("BE-post-") + m_label);
+#endif
+}
+
+void BoundaryExchange::pack_and_send (const ConnectionSharing sharing)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -490,49 +598,69 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
+  pack_fields(sharing);
+  Kokkos::fence();
+
+  // ---- Send ---- //
+  tstart("be sync_send_buffer");
+  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
+  tstop("be sync_send_buffer");
+  tstart("be send");
+  if ( ! m_send_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  send_to_node_peers();
+  tstop("be send");
+
+  // Notify a send is ongoing
+  m_send_pending = true;
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_fields (const ConnectionSharing sharing)
+{
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  const auto& elems = m_connectivity->get_d_elem_traversal();
+  const int pack_sharing = etoi(sharing);
+  // Fused min/max fields (if any) cannot be packed one kind of connection at a time
+  if (m_num_1d_fields > 0) {
+    Errors::runtime_check(sharing == ConnectionSharing::ANY,
+                          "A fused BoundaryExchange with min/max fields cannot do split packing");
+    pack_min_max(ucon, ucon_ptr, m_1d_fields, m_send_1d_buffers, m_num_elems, m_num_1d_fields);
+  }
   // First, pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, pack_sharing, m_num_elems,
          m_num_2d_fields);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, elems, m_send_3d_buffers, pack_sharing,
                           m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, elems, m_send_3d_buffers, pack_sharing,
                     m_num_elems, m_num_3d_fields);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, elems, m_send_3d_int_buffers, pack_sharing,
                     m_num_elems, m_num_3d_int_fields);
-  Kokkos::fence();
-
-  // ---- Send ---- //
-  tstart("be sync_send_buffer");
-  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
-  tstop("be sync_send_buffer");
-  tstart("be send");
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
-
-  // Notify a send is ongoing
-  m_send_pending = true;
-  tstop("be pack_and_send");
 }
 
 void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
         const ExecViewUnmanaged<const int*> ucon_ptr,
+        const ExecViewUnmanaged<const int*> elems,
         const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
         const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> recv_2d_buffers,
         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
@@ -541,7 +669,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
   Kokkos::parallel_for(
     Kokkos::RangePolicy<ExecSpace>(0, num_elems*num_2d_fields),
     KOKKOS_LAMBDA(const int it) {
-      const int ie = it / num_2d_fields;
+      const int ie = elem_id(elems, it / num_2d_fields);
       const int ifield = it % num_2d_fields;
       const auto iconn_beg = ucon_ptr(ie), iconn_end = ucon_ptr(ie+1);
       const auto& f2 = fields_2d(ie, ifield);
@@ -565,7 +693,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
     Kokkos::parallel_for(
       Kokkos::RangePolicy<ExecSpace>(0, num_elems*num_2d_fields*NP*NP),
       KOKKOS_LAMBDA(const int it) {
-        const int ie = it / (num_2d_fields*NP*NP);
+        const int ie = elem_id(elems, it / (num_2d_fields*NP*NP));
         const int ifield = (it / (NP*NP)) % num_2d_fields;
         const int i = (it / NP) % NP;
         const int j = it % NP;
@@ -579,6 +707,7 @@ template <int NUM_LEV_PACKS, bool partial_column=false>
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
         const ExecViewUnmanaged<const int*> ucon_ptr,
+        const ExecViewUnmanaged<const int*> elems,
         const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
         const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> recv_3d_buffers,
         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
@@ -599,7 +728,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
           if (ilev >= nlev_packs(ifield))
             return;
         }
-        const int ie = it / (num_3d_fields*NUM_LEV_PACKS);
+        const int ie = elem_id(elems, it / (num_3d_fields*NUM_LEV_PACKS));
         const auto iconn_beg = ucon_ptr(ie);
         const auto& f3 = fields_3d(ie, ifield);
         for (int k = 0; k < NP; ++k) {
@@ -622,7 +751,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
       Kokkos::parallel_for(
         Kokkos::RangePolicy<ExecSpace>(0, num_elems*num_3d_fields*NP*NP*NUM_LEV_PACKS),
         KOKKOS_LAMBDA(const int it) {
-          const int ie = it / (num_3d_fields*NUM_LEV_PACKS*NP*NP);
+          const int ie = elem_id(elems, it / (num_3d_fields*NUM_LEV_PACKS*NP*NP));
           const int ifield = (it / (NP*NP*NUM_LEV_PACKS)) % num_3d_fields;
           const int i = (it / (NP*NUM_LEV_PACKS)) % NP;
           const int j = (it / NUM_LEV_PACKS) % NP;
@@ -637,7 +766,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
       Kokkos::TeamPolicy<ExecSpace>(num_parallel_iterations, 1, NUM_LEV_PACKS),
       KOKKOS_LAMBDA(const TeamMember& team) {
         Homme::KernelVariables kv(team, num_3d_fields);
-        const int ie = kv.ie;
+        const int ie = elem_id(elems, kv.ie);
         const int ifield = kv.iq;
         const auto tvr = Kokkos::ThreadVectorRange(
           kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
@@ -687,6 +816,9 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   // Check that this object is setup to perform exchange and not exchange_min_max
   assert (m_exchange_type==MPI_EXCHANGE);
 
+  // After pack_and_send_shared, the on-rank connections must be packed too
+  assert (!m_local_pack_pending);
+
   // I am not sure why and if we could have this scenario, but just in case. I
   // think MPI *may* go bananas in this case
   if (m_num_2d_fields+m_num_3d_fields==0) {
@@ -708,39 +840,32 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   }
   tstop("be recv_and_unpack book");
 
-  // ---- Recv ---- //
-  tstart("be recv waitall");
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
-  m_recv_pending = false;
-  tstop("be recv waitall");
+  if (m_progressive_unpack) {
+    // ---- Recv and unpack, one batch of ready elements at a time ---- //
+    recv_and_unpack_progressively(rspheremp);
+  } else {
+    // ---- Recv ---- //
+    tstart("be recv waitall");
+    if ( ! m_recv_requests.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
+                              m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+    recv_from_node_peers();
+    m_recv_pending = false;
+    tstop("be recv waitall");
 
-  tstart("be recv_and_unpack book");
-  m_buffers_manager->sync_recv_buffer(this);
+    tstart("be recv_and_unpack book");
+    m_buffers_manager->sync_recv_buffer(this);
 
-  tstop("be recv_and_unpack book");
+    tstop("be recv_and_unpack book");
 
-  // --- Unpack --- //
-  const auto& ucon = m_connectivity->get_d_ucon();
-  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, unpack 2d fields (if any)...
-  if (m_num_2d_fields>0)
-    unpack(ucon, ucon_ptr, m_2d_fields, m_recv_2d_buffers, rspheremp, m_num_elems,
-           m_num_2d_fields);
-  // ...then unpack 3d fields (if any)...
-  if (m_num_3d_fields>0) {
-    if (m_3d_nlev_pack_d.size() > 0)
-      unpack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
-                            m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
-    else
-      unpack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
-                      m_num_elems, m_num_3d_fields);
+    // --- Unpack --- //
+    unpack_elems(m_connectivity->get_d_elem_traversal(), m_num_elems, rspheremp);
+  }
+  if (m_num_1d_fields>0) {
+    // Fused min/max fields: all messages have arrived by now
+    unpack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
+                   m_1d_fields, m_recv_1d_buffers, m_num_elems, m_num_1d_fields);
   }
-  // ...then unpack 3d interface fields (if any).
-  if (m_num_3d_int_fields > 0)
-    unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
-                      m_num_elems, m_num_3d_int_fields);
   Kokkos::fence();
 
   // If another BE structure starts an exchange, it has no way to check that
@@ -764,6 +889,107 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   tstop("be recv_and_unpack");
 }
 
+void BoundaryExchange::unpack_elems (const ExecViewUnmanaged<const int*> elems,
+                                     const int num_elems,
+                                     const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  const auto& ucon = m_connectivity->get_d_ucon();
+  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  // First, unpack 2d fields (if any)...
+  if (m_num_2d_fields>0)
+    unpack(ucon, ucon_ptr, elems, m_2d_fields, m_recv_2d_buffers, rspheremp, num_elems,
+           m_num_2d_fields);
+  // ...then unpack 3d fields (if any)...
+  if (m_num_3d_fields>0) {
+    if (m_3d_nlev_pack_d.size() > 0)
+      unpack<NUM_LEV, true>(ucon, ucon_ptr, elems, m_3d_fields, m_recv_3d_buffers, rspheremp,
+                            num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+    else
+      unpack<NUM_LEV>(ucon, ucon_ptr, elems, m_3d_fields, m_recv_3d_buffers, rspheremp,
+                      num_elems, m_num_3d_fields);
+  }
+  // ...then unpack 3d interface fields (if any).
+  if (m_num_3d_int_fields > 0)
+    unpack<NUM_LEV_P>(ucon, ucon_ptr, elems, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
+                      num_elems, m_num_3d_int_fields);
+}
+
+void BoundaryExchange::recv_and_unpack_progressively (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  // An element is unpacked as a whole, in the usual connection order, once all
+  // the messages it depends on have arrived. Hence, the result is BFB with the
+  // non-progressive unpack, regardless of the order in which messages arrive.
+
+  // Elements with on-rank connections only can be unpacked right away, since
+  // pack_and_send has already filled the local buffer.
+  int num_ready = m_num_local_only_elems;
+  if (num_ready>0) {
+    unpack_elems(Kokkos::subview(m_unpack_elems, std::make_pair(0, num_ready)),
+                 num_ready, rspheremp);
+  }
+
+  tstart("be recv waitsome");
+  std::copy(m_elem_num_remote_pids.begin(), m_elem_num_remote_pids.end(),
+            m_elem_num_pending_pids.begin());
+
+  // Mark the elements fed by the ip-th pid's message as ready, if it was the
+  // last one they waited on.
+  const auto recvd = [&] (const int ip) {
+    m_buffers_manager->sync_recv_buffer(this, m_recv_pid_offsets[ip],
+                                        m_recv_pid_offsets[ip+1] - m_recv_pid_offsets[ip]);
+    for (int k=m_pid_elems_ptr[ip]; k<m_pid_elems_ptr[ip+1]; ++k) {
+      const int ie = m_pid_elems[k];
+      if (--m_elem_num_pending_pids[ie]==0) {
+        m_unpack_elems_h(num_ready++) = ie;
+      }
+    }
+  };
+  const auto unpack_batch = [&] (const int batch_beg) {
+    if (num_ready>batch_beg) {
+      // Each batch owns a distinct slice of the elements list. The deep_copy
+      // from host fences, so the previous batch's unpack is done before this
+      // one starts: unpack overlaps with the messages still in flight, not
+      // with other batches.
+      const auto batch = std::make_pair(batch_beg, num_ready);
+      const auto elems = Kokkos::subview(m_unpack_elems, batch);
+      Kokkos::deep_copy(elems, Kokkos::subview(m_unpack_elems_h, batch));
+      unpack_elems(elems, num_ready-batch_beg, rspheremp);
+    }
+  };
+
+  // On-node data is put in our buffer directly, and arrives first: unpack it
+  // as a single batch
+  if (!m_node_peers.empty()) {
+    const int batch_beg = num_ready;
+    for (const auto& peer : m_node_peers) {
+      m_buffers_manager->node_wait(peer.node_rank);
+      recvd(peer.ip);
+    }
+    unpack_batch(batch_beg);
+  }
+
+  const int num_recv = m_recv_requests.size();
+  int num_recv_pending = num_recv;
+  while (num_recv_pending>0) {
+    int num_completed;
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitsome(num_recv, m_recv_requests.data(), &num_completed,
+                                         m_completed_recv_idx.data(), MPI_STATUSES_IGNORE),
+                            m_connectivity->get_comm().mpi_comm());
+    assert (num_completed!=MPI_UNDEFINED && num_completed>0);
+    num_recv_pending -= num_completed;
+
+    const int batch_beg = num_ready;
+    for (int i=0; i<num_completed; ++i) {
+      recvd(m_req_pids[m_completed_recv_idx[i]]);
+    }
+    unpack_batch(batch_beg);
+  }
+  m_recv_pending = false;
+  tstop("be recv waitsome");
+
+  assert (num_ready==m_num_elems);
+}
+
 static void pack_min_max (
   const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
   const ExecViewUnmanaged<const int*> ucon_ptr,
@@ -866,6 +1092,7 @@ void BoundaryExchange::pack_and_send_min_max ()
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
+  send_to_node_peers();
 
   // Mark send buffer as busy
   m_send_pending = true;
@@ -968,6 +1195,7 @@ void BoundaryExchange::recv_and_unpack_min_max ()
   if ( ! m_recv_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  recv_from_node_peers();
 
   m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
 
@@ -1146,30 +1374,48 @@ void BoundaryExchange::build_buffer_views_and_requests()
     const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
     const size_t npids = pids.size();
     free_requests();
-    m_send_requests.resize(npids);
-    m_recv_requests.resize(npids);
+    m_send_requests.reserve(npids);
+    m_recv_requests.reserve(npids);
+    m_req_pids.clear();
+    m_node_peers.clear();
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
+    m_recv_pid_offsets.resize(npids+1);
     int offset = 0;
     for (size_t ip = 0; ip < npids; ++ip) {
+      m_recv_pid_offsets[ip] = offset;
       int count = 0;
       for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
         const auto i = slot_idx_to_elem_conn_pair[k];
         const auto& info = ucon(i);
         count += m_elem_buf_size[info.kind];
       }
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_send_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_recv_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
+      const int node_rank = buffers_manager->get_node_rank(pids[ip]);
+      if (node_rank>=0) {
+        // No MPI for this pid: its data is put directly in our mpi recv buffer
+        m_node_peers.push_back(NodePeer{static_cast<int>(ip), node_rank, -1});
+      } else {
+        m_send_requests.emplace_back();
+        m_recv_requests.emplace_back();
+        m_req_pids.push_back(ip);
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_send_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_recv_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+      }
       offset += count;
     }
+    m_recv_pid_offsets[npids] = offset;
   }
 
+  init_node_peers(pids);
+
+  init_progressive_unpack(slot_idx_to_elem_conn_pair, pid_offsets);
+
   // Now the buffer views and the requests are built
   m_buffer_views_and_requests_built = true;
 }
@@ -1186,6 +1432,208 @@ void BoundaryExchange
   m_recv_requests.clear();
 }
 
+void BoundaryExchange
+::init_node_peers (const std::vector<int>& pids)
+{
+  if (m_node_peers.empty()) {
+    return;
+  }
+
+  // Each on-node neighbor needs to know where its data goes in our mpi recv
+  // buffer. The slot ordering is the same on both sides, but the offset of a
+  // pid's message depends on the receiver's other neighbors, so ask them.
+  const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+  const int num_peers = m_node_peers.size();
+  std::vector<int> offsets(num_peers);
+  std::vector<MPI_Request> requests(2*num_peers);
+  for (int i = 0; i < num_peers; ++i) {
+    auto& peer = m_node_peers[i];
+    offsets[i] = m_recv_pid_offsets[peer.ip];
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Irecv(&peer.remote_offset, 1, MPI_INT, pids[peer.ip],
+                                      m_exchange_type, mpi_comm, &requests[2*i]),
+                            mpi_comm);
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Isend(&offsets[i], 1, MPI_INT, pids[peer.ip],
+                                      m_exchange_type, mpi_comm, &requests[2*i+1]),
+                            mpi_comm);
+  }
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE),
+                          mpi_comm);
+}
+
+void BoundaryExchange::send_to_node_peers ()
+{
+  for (const auto& peer : m_node_peers) {
+    const int ip = peer.ip;
+    m_buffers_manager->node_put(peer.node_rank, m_recv_pid_offsets[ip], peer.remote_offset,
+                                m_recv_pid_offsets[ip+1] - m_recv_pid_offsets[ip]);
+  }
+}
+
+void BoundaryExchange::recv_from_node_peers ()
+{
+  for (const auto& peer : m_node_peers) {
+    m_buffers_manager->node_wait(peer.node_rank);
+  }
+}
+
+void BoundaryExchange
+::init_progressive_unpack (
+  const std::vector<int>& slot_idx_to_elem_conn_pair,
+  const std::vector<int>& pid_offsets)
+{
+  const auto& ucon = m_connectivity->get_h_ucon();
+  const int npids = pid_offsets.size()-1;
+
+  // For each remote pid, collect the (unique) local elements its message
+  // feeds, and count, for each element, how many messages it waits on.
+  m_pid_elems_ptr.assign(npids+1, 0);
+  m_pid_elems.clear();
+  m_elem_num_remote_pids.assign(m_num_elems, 0);
+  m_elem_num_pending_pids.resize(m_num_elems);
+  m_completed_recv_idx.resize(npids);
+  std::vector<int> last_pid(m_num_elems, -1);
+  for (int ip = 0; ip < npids; ++ip) {
+    for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
+      const int ie = ucon(slot_idx_to_elem_conn_pair[k]).local_lid;
+      if (last_pid[ie] != ip) {
+        last_pid[ie] = ip;
+        m_pid_elems.push_back(ie);
+        ++m_elem_num_remote_pids[ie];
+      }
+    }
+    m_pid_elems_ptr[ip+1] = m_pid_elems.size();
+  }
+
+  // Elements with no remote dependency go first in the unpack order. The rest
+  // of the list is filled at every exchange, as messages arrive.
+  m_unpack_elems = decltype(m_unpack_elems)("unpack elems", m_num_elems);
+  m_unpack_elems_h = Kokkos::create_mirror_view(m_unpack_elems);
+  m_num_local_only_elems = 0;
+  for (int ie = 0; ie < m_num_elems; ++ie) {
+    if (m_elem_num_remote_pids[ie]==0) {
+      m_unpack_elems_h(m_num_local_only_elems++) = ie;
+    }
+  }
+  const auto local_only = std::make_pair(0, m_num_local_only_elems);
+  Kokkos::deep_copy(Kokkos::subview(m_unpack_elems, local_only),
+                    Kokkos::subview(m_unpack_elems_h, local_only));
+}
+
+template<typename FieldsView>
+static void append_fields (const FieldsView& dst, const int dst_offset,
+                           const FieldsView& src, const int num_fields, const int num_elems)
+{
+  if (num_fields==0) {
+    return;
+  }
+  Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {num_elems, num_fields}, {1, 1}),
+                       KOKKOS_LAMBDA(const int ie, const int ifield){
+    dst(ie, dst_offset+ifield) = src(ie, ifield);
+  });
+}
+
+void BoundaryExchange::register_fields (const BoundaryExchange& src)
+{
+  // Sanity checks
+  assert (m_registration_started && !m_registration_completed);
+  assert (src.m_registration_completed);
+  assert (src.m_connectivity==m_connectivity);
+  assert (m_num_1d_fields+src.m_num_1d_fields<=m_1d_fields.extent_int(1));
+  assert (m_num_2d_fields+src.m_num_2d_fields<=m_2d_fields.extent_int(1));
+  assert (m_num_3d_fields+src.m_num_3d_fields<=m_3d_fields.extent_int(1));
+  assert (m_num_3d_int_fields+src.m_num_3d_int_fields<=m_3d_int_fields.extent_int(1));
+
+  append_fields(m_1d_fields, m_num_1d_fields, src.m_1d_fields, src.m_num_1d_fields, m_num_elems);
+  append_fields(m_2d_fields, m_num_2d_fields, src.m_2d_fields, src.m_num_2d_fields, m_num_elems);
+  append_fields(m_3d_fields, m_num_3d_fields, src.m_3d_fields, src.m_num_3d_fields, m_num_elems);
+  append_fields(m_3d_int_fields, m_num_3d_int_fields, src.m_3d_int_fields, src.m_num_3d_int_fields, m_num_elems);
+
+  // Note: src cleared its nlev's at registration if all of them were NUM_LEV
+  for (int i = 0; i < src.m_num_3d_fields; ++i) {
+    m_3d_nlev_pack.push_back(src.m_3d_nlev_pack.empty() ? NUM_LEV : src.m_3d_nlev_pack[i]);
+  }
+
+  m_num_1d_fields += src.m_num_1d_fields;
+  m_num_2d_fields += src.m_num_2d_fields;
+  m_num_3d_fields += src.m_num_3d_fields;
+  m_num_3d_int_fields += src.m_num_3d_int_fields;
+}
+
+std::vector<size_t> BoundaryExchange::get_fields_ptrs () const
+{
+  // The address of each field on the first element. If two BE's share a field, they
+  // share this address.
+  const int n1 = m_num_1d_fields, n2 = m_num_2d_fields, n3 = m_num_3d_fields;
+  const int num_fields = n1 + n2 + n3 + m_num_3d_int_fields;
+  ExecViewManaged<size_t*> ptrs("fields ptrs", num_fields);
+  const auto f1 = m_1d_fields;
+  const auto f2 = m_2d_fields;
+  const auto f3 = m_3d_fields;
+  const auto f3i = m_3d_int_fields;
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, num_fields),
+                       KOKKOS_LAMBDA(const int i){
+    const void* p = (i < n1       ? static_cast<const void*>(f1(0, i).data()) :
+                     i < n1+n2    ? static_cast<const void*>(f2(0, i-n1).data()) :
+                     i < n1+n2+n3 ? static_cast<const void*>(f3(0, i-n1-n2).data()) :
+                     /**/           static_cast<const void*>(f3i(0, i-n1-n2-n3).data()));
+    ptrs(i) = reinterpret_cast<size_t>(p);
+  });
+  const auto ptrs_h = Kokkos::create_mirror_view(ptrs);
+  Kokkos::deep_copy(ptrs_h, ptrs);
+  return std::vector<size_t>(ptrs_h.data(), ptrs_h.data()+num_fields);
+}
+
+bool BoundaryExchange
+::are_fusible (const std::vector<std::shared_ptr<BoundaryExchange>>& bes)
+{
+  if (bes.size()<2) {
+    return false;
+  }
+
+  std::vector<size_t> ptrs;
+  for (const auto& be : bes) {
+    if (!be || !be->m_registration_completed || be->m_connectivity!=bes[0]->m_connectivity ||
+        be->m_num_elems==0) {
+      return false;
+    }
+    const auto be_ptrs = be->get_fields_ptrs();
+    ptrs.insert(ptrs.end(), be_ptrs.begin(), be_ptrs.end());
+  }
+
+  // Fusing BE's that share a field would exchange it once rather than twice
+  std::sort(ptrs.begin(), ptrs.end());
+  return std::adjacent_find(ptrs.begin(), ptrs.end()) == ptrs.end();
+}
+
+std::shared_ptr<BoundaryExchange> BoundaryExchange
+::fuse (const std::vector<std::shared_ptr<BoundaryExchange>>& bes,
+        std::shared_ptr<MpiBuffersManager> buffers_manager)
+{
+  Errors::runtime_check(are_fusible(bes), "The given BoundaryExchange's cannot be fused");
+
+  auto fused = std::make_shared<BoundaryExchange>(bes[0]->m_connectivity, buffers_manager);
+  int num_1d = 0, num_2d = 0, num_3d = 0, num_3d_int = 0;
+  std::string label;
+  for (const auto& be : bes) {
+    num_1d += be->m_num_1d_fields;
+    num_2d += be->m_num_2d_fields;
+    num_3d += be->m_num_3d_fields;
+    num_3d_int += be->m_num_3d_int_fields;
+    label += (label.empty() ? "" : "+") + be->m_label;
+    fused->m_diagnostics_level = std::max(fused->m_diagnostics_level, be->m_diagnostics_level);
+  }
+  fused->set_label(label);
+
+  fused->m_fused = true;
+  fused->set_num_fields(num_1d, num_2d, num_3d, num_3d_int);
+  for (const auto& be : bes) {
+    fused->register_fields(*be);
+  }
+  fused->registration_completed();
+
+  return fused;
+}
+
 // A slot is the space in a communication buffer for an (element, connection)
 // pair. The slot index space numbers slots so that, first, they are contiguous
 // by remote PID and, second, within a PID block, each comm partner agrees on
@@ -61,6 +61,8 @@ class MpiBuffersManager;
  *          2d/3d fields. The idea is that 1d fields are exchanged only as
  *          min/max quantities (so they are not accumulated). Please, use
  *          two different BE objects for accumulation and for min/max.
+ *          If the two exchanges happen at the same time, you can then
+ *          fuse them (see BoundaryExchange::fuse).
  *  - a call to registration_completed, which ends the registration phase,
  *    and sets up all the internal structure to prepare for calls to
  *    exchange(). This method MUST be called BEFORE any call to exchange.
@@ -218,11 +220,51 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Split version of pack_and_send, to overlap communication with computation:
+  // pack_and_send_shared packs and sends only the connections shared with
+  // remote processes, so it only needs the fields on the boundary elements (see
+  // Connectivity::get_d_elem_order) to be up to date. pack_local packs the
+  // on-rank connections, and must be called before recv_and_unpack.
+  void pack_and_send_shared ();
+  void pack_local ();
+
+  // Exchange all registered 2d and 3d fields, overlapping communication with
+  // the computation of the fields themselves. compute(first,count) must update
+  // the registered fields on the elements with local ids
+  //   connectivity.get_h_elem_order()(first:first+count-1)
+  // (e.g., using ElementSubset in the kernels). It is called first on the
+  // boundary elements, and then on the interior elements, while the messages
+  // to remote processes are in flight. The result is BFB with computing all
+  // elements and then calling exchange.
+  template<typename ComputeFunc>
+  void exchange_overlapped (const ComputeFunc& compute);
+  template<typename ComputeFunc>
+  void exchange_overlapped (const ComputeFunc& compute,
+                            ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
   void recv_and_unpack_min_max ();
 
+  // Exchange coalescing. BE's whose exchanges are issued back to back, with no change
+  // to their fields in between, can be fused into a single BE, which exchanges all
+  // their fields with one message per neighbor and one pack/unpack pass. This pays
+  // off when messages are small, and latency dominates.
+  // are_fusible is the planner: BE's are fusible if they all completed the registration,
+  // share the same connectivity, and no field is registered in more than one of them.
+  // This is the same on all ranks, so all ranks make the same choice.
+  // The fused BE is a new customer of the given buffers manager (the BE's themselves
+  // are left untouched). If some BE's have min/max fields and some do not, the fused BE
+  // exchanges all of them with exchange(...), where rspheremp is only applied to the
+  // 2d/3d fields, and the min/max fields are unpacked after all messages arrived.
+  // Such a fused BE cannot do split (overlapped) packing.
+  static bool are_fusible (const std::vector<std::shared_ptr<BoundaryExchange>>& bes);
+  static std::shared_ptr<BoundaryExchange>
+  fuse (const std::vector<std::shared_ptr<BoundaryExchange>>& bes,
+        std::shared_ptr<MpiBuffersManager> buffers_manager);
+
   // If you are really not sure whether we are still transmitting, you can make sure we're done by calling this
   void waitall ();
 
@@ -233,6 +275,13 @@ public:
   // Request diagnostic output after each boundary exchange. Default is level =
   // 0, corresponding to none.
   void set_diagnostics_level (const int level);
+  // If true, recv_and_unpack waits on the neighbors' messages with MPI_Waitsome,
+  // and unpacks each element as soon as all the messages it depends on have
+  // arrived, overlapping unpack with the remaining communication. Results are
+  // BFB with the default (false), which unpacks after all messages arrived.
+  // Can only be changed when no exchange is in progress.
+  void set_progressive_unpack (const bool progressive);
+  bool get_progressive_unpack () const { return m_progressive_unpack; }
 
 private:
 
@@ -301,22 +350,110 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_local_pack_pending;
+  bool        m_fused;
 
   int         m_num_elems;
 
   std::string m_label;
   int m_diagnostics_level;
 
+  // Progressive unpack (see set_progressive_unpack) bookkeeping, built
+  // together with the requests:
+  //  - m_recv_pid_offsets: offsets of each remote pid's message in the mpi recv buffer;
+  //  - m_pid_elems_ptr/m_pid_elems: (CSR) the local elements each pid's message feeds;
+  //  - m_elem_num_remote_pids: how many remote pids each element depends on;
+  //  - m_unpack_elems: elements in the order they are unpacked; the first
+  //    m_num_local_only_elems are those with no remote pid dependency.
+  bool m_progressive_unpack;
+  std::vector<int> m_recv_pid_offsets;
+  std::vector<int> m_pid_elems_ptr;
+  std::vector<int> m_pid_elems;
+  std::vector<int> m_elem_num_remote_pids;
+  std::vector<int> m_elem_num_pending_pids;
+  std::vector<int> m_completed_recv_idx;
+  int m_num_local_only_elems;
+  ExecViewManaged<int*> m_unpack_elems;
+  ExecViewManaged<int*>::HostMirror m_unpack_elems_h;
+
+  // If the buffers manager has the node-shared memory enabled, the pids on our
+  // node get no MPI requests; rather, we put our data straight into their mpi
+  // recv buffer, at the offset they told us (see MpiBuffersManager):
+  //  - m_req_pids: the index of the pid of each send/recv request;
+  //  - m_node_peers: the on-node pids, with their node rank and our offset
+  //    in their mpi recv buffer.
+  struct NodePeer {
+    int ip;
+    int node_rank;
+    int remote_offset;
+  };
+  std::vector<int> m_req_pids;
+  std::vector<NodePeer> m_node_peers;
+
   void init_slot_idx_to_elem_conn_pair(
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  void register_fields(const BoundaryExchange& src);
+  std::vector<size_t> get_fields_ptrs() const;
+  void init_node_peers(const std::vector<int>& pids);
+  void send_to_node_peers();
+  void recv_from_node_peers();
+  void pack_and_send (const ConnectionSharing sharing);
+  void pack_fields (const ConnectionSharing sharing);
+  template<typename ComputeFunc>
+  void exchange_overlapped (const ComputeFunc& compute,
+                            const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void finish_overlapped_exchange (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void init_progressive_unpack(
+    const std::vector<int>& slot_idx_to_elem_conn_pair,
+    const std::vector<int>& pid_offsets);
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void recv_and_unpack_progressively(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void unpack_elems(const ExecViewUnmanaged<const int*> elems, const int num_elems,
+                    const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 };
 
+// ========================= OVERLAPPED EXCHANGE ========================= //
+
+template<typename ComputeFunc>
+void BoundaryExchange::exchange_overlapped (const ComputeFunc& compute)
+{
+  exchange_overlapped(compute, nullptr);
+}
+
+template<typename ComputeFunc>
+void BoundaryExchange::exchange_overlapped (const ComputeFunc& compute,
+                                            ExecViewUnmanaged<const Real * [NP][NP]> rspheremp)
+{
+  exchange_overlapped(compute, &rspheremp);
+}
+
+template<typename ComputeFunc>
+void BoundaryExchange::exchange_overlapped (const ComputeFunc& compute,
+                                            const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  assert (m_registration_completed);
+
+  const int num_bndry = m_connectivity->get_num_boundary_elements();
+  const int num_elems = m_connectivity->get_num_local_elements();
+
+  // Boundary elements first, so that their data can be sent right away...
+  if (num_bndry>0) {
+    compute(0, num_bndry);
+  }
+  pack_and_send_shared();
+
+  // ...then the interior elements, while the messages are in flight.
+  if (num_elems>num_bndry) {
+    compute(num_bndry, num_elems-num_bndry);
+  }
+  finish_overlapped_exchange(rspheremp);
+}
+
 // ============================ REGISTER METHODS ========================= //
 
 // --- 2d fields --- //
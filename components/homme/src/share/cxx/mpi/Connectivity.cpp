@@ -9,6 +9,7 @@
 
 #include <array>
 #include <algorithm>
+#include <cstdint>
 
 namespace Homme
 {
@@ -16,8 +17,10 @@ namespace Homme
 Connectivity::Connectivity ()
  : m_finalized    (false)
  , m_initialized  (false)
+ , m_elem_order_sfc (false)
  , m_num_local_elements (-1)
  , m_max_corner_elements(-1)
+ , m_num_boundary_elements(0)
 {
   // Nothing to be done here
 }
@@ -136,6 +139,7 @@ void Connectivity::finalize(const bool sanity_check)
   }
 
   setup_ucon();
+  setup_elem_order();
 
   m_finalized = true;
 }
@@ -313,6 +317,50 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::setup_elem_order () {
+  d_elem_order = decltype(d_elem_order)("Element order", m_num_local_elements);
+  h_elem_order = Kokkos::create_mirror_view(d_elem_order);
+
+  std::vector<int> interior;
+  m_num_boundary_elements = 0;
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool boundary = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k)
+      boundary = boundary || h_ucon(k).sharing == etoi(ConnectionSharing::SHARED);
+    if (boundary)
+      h_elem_order(m_num_boundary_elements++) = ie;
+    else
+      interior.push_back(ie);
+  }
+  for (size_t i = 0; i < interior.size(); ++i)
+    h_elem_order(m_num_boundary_elements + i) = interior[i];
+
+  Kokkos::deep_copy(d_elem_order, h_elem_order);
+}
+
+void Connectivity::set_elem_order_sfc (const HostViewUnmanaged<const Real*[3]>& centers)
+{
+  Errors::runtime_check(m_finalized, "Connectivity::set_elem_order_sfc requires a finalized connectivity");
+  Errors::runtime_check(centers.extent_int(0) == m_num_local_elements,
+                        "Connectivity::set_elem_order_sfc: need one center per local element");
+
+  // Position of each element along the curve
+  const auto order = hilbert_order(centers);
+  std::vector<int> pos(m_num_local_elements);
+  for (int i = 0; i < m_num_local_elements; ++i) {
+    pos[order[i]] = i;
+  }
+
+  // Sort each group separately, so the boundary elements still come first
+  const auto cmp = [&] (const int a, const int b) { return pos[a] < pos[b]; };
+  int* const beg = h_elem_order.data();
+  std::sort(beg, beg + m_num_boundary_elements, cmp);
+  std::sort(beg + m_num_boundary_elements, beg + m_num_local_elements, cmp);
+  Kokkos::deep_copy(d_elem_order, h_elem_order);
+
+  m_elem_order_sfc = true;
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
@@ -322,9 +370,104 @@ void Connectivity::clean_up()
   h_ucon = decltype(h_ucon)("", 0);
   d_ucon_ptr = decltype(d_ucon_ptr)("", 0);
   h_ucon_ptr = decltype(h_ucon_ptr)("", 0);
+  d_elem_order = decltype(d_elem_order)("", 0);
+  h_elem_order = decltype(h_elem_order)("", 0);
+  m_num_boundary_elements = 0;
+  m_elem_order_sfc = false;
 
   m_initialized = false;
   m_finalized   = false;
 }
 
+// Convert the coordinates x(0:n-1), each in [0,2^b), to the transposed Hilbert
+// index in place (J. Skilling, "Programming the Hilbert curve", 2004).
+static void hilbert_axes_to_transpose (std::uint32_t* const x, const int b, const int n)
+{
+  const std::uint32_t m = 1u << (b-1);
+  // Inverse undo
+  for (std::uint32_t q = m; q > 1; q >>= 1) {
+    const std::uint32_t p = q - 1;
+    for (int i = 0; i < n; ++i) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        const std::uint32_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  // Gray encode
+  for (int i = 1; i < n; ++i) {
+    x[i] ^= x[i-1];
+  }
+  std::uint32_t t = 0;
+  for (std::uint32_t q = m; q > 1; q >>= 1) {
+    if (x[n-1] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (int i = 0; i < n; ++i) {
+    x[i] ^= t;
+  }
+}
+
+std::vector<int> hilbert_order (const HostViewUnmanaged<const Real*[3]>& pts)
+{
+  const int npts = pts.extent_int(0);
+  std::vector<int> order(npts);
+  for (int i = 0; i < npts; ++i) {
+    order[i] = i;
+  }
+  if (npts < 2) {
+    return order;
+  }
+
+  // Bounding box, and the coordinates along which the points vary. The same
+  // scale is used for all of them, so the curve is not stretched.
+  Real lo[3], hi[3];
+  for (int d = 0; d < 3; ++d) {
+    lo[d] = hi[d] = pts(0,d);
+    for (int i = 1; i < npts; ++i) {
+      lo[d] = std::min(lo[d], pts(i,d));
+      hi[d] = std::max(hi[d], pts(i,d));
+    }
+  }
+  const Real extent = std::max(hi[0]-lo[0], std::max(hi[1]-lo[1], hi[2]-lo[2]));
+  if (extent == 0) {
+    return order;
+  }
+  int dims[3], n = 0;
+  for (int d = 0; d < 3; ++d) {
+    if (hi[d] - lo[d] > 1e-12*extent) {
+      dims[n++] = d;
+    }
+  }
+
+  // 16 bits per coordinate, so the key fits in 48 bits
+  constexpr int b = 16;
+  constexpr Real scale = (1 << b) - 1;
+  std::vector<std::uint64_t> key(npts);
+  for (int i = 0; i < npts; ++i) {
+    std::uint32_t x[3];
+    for (int k = 0; k < n; ++k) {
+      const int d = dims[k];
+      x[k] = static_cast<std::uint32_t>(scale*(pts(i,d) - lo[d])/extent);
+    }
+    hilbert_axes_to_transpose(x, b, n);
+    // Interleave the bits of the transposed index, most significant first
+    std::uint64_t h = 0;
+    for (int bit = b-1; bit >= 0; --bit) {
+      for (int k = 0; k < n; ++k) {
+        h = (h << 1) | ((x[k] >> bit) & 1);
+      }
+    }
+    key[i] = h;
+  }
+
+  std::stable_sort(order.begin(), order.end(),
+                   [&] (const int a, const int c) { return key[a] < key[c]; });
+  return order;
+}
+
 } // namespace Homme
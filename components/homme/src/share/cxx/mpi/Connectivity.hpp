@@ -11,6 +11,8 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -84,6 +86,14 @@ public:
 
   void finalize (const bool sanity_check = true);
 
+  // Within each of the boundary and interior groups of get_d_elem_order, order
+  // the elements along a Hilbert space-filling curve through their centers,
+  // centers(ie,:) for local id ie. Only the order in which kernels visit the
+  // elements changes; the storage, and thus the mapping to the F90 element
+  // index, is untouched. The order views are updated in place, so views
+  // obtained before this call see the new order. Call after finalize.
+  void set_elem_order_sfc (const HostViewUnmanaged<const Real*[3]>& centers);
+
   void clean_up ();
   //@}
 
@@ -123,6 +133,22 @@ public:
   int get_num_local_connections  () const { return get_num_connections<MemSpace>(ConnectionSharing::LOCAL, ConnectionKind::ANY); }
 
   int get_num_local_elements     () const { return m_num_local_elements;  }
+
+  // Local element ids ordered so that boundary elements (those with at least
+  // one connection shared with a remote process) come first, followed by the
+  // interior elements. Within each group, ids are ascending. Kernels that feed
+  // a boundary exchange can process the first get_num_boundary_elements()
+  // entries, start the remote communication, and then process the interior.
+  ExecViewUnmanaged<const int*> get_d_elem_order () const { return d_elem_order; }
+  HostViewUnmanaged<const int*> get_h_elem_order () const { return h_elem_order; }
+  int get_num_boundary_elements  () const { return m_num_boundary_elements; }
+  // The order in which to visit all local elements when the kernel does not
+  // need the boundary elements first: the elem order if it follows the SFC, and
+  // otherwise empty, meaning the identity.
+  ExecViewUnmanaged<const int*> get_d_elem_traversal () const {
+    return m_elem_order_sfc ? ExecViewUnmanaged<const int*>(d_elem_order) : ExecViewUnmanaged<const int*>();
+  }
+  bool is_elem_order_sfc () const { return m_elem_order_sfc; }
   int get_max_corner_elements    () const { return m_max_corner_elements; }
 
   bool is_initialized () const { return m_initialized; }
@@ -141,8 +167,10 @@ private:
 
   bool    m_finalized;
   bool    m_initialized;
+  bool    m_elem_order_sfc;
 
   int     m_num_local_elements, m_max_corner_elements;
+  int     m_num_boundary_elements;
 
   ConnectionHelpers m_helpers;
 
@@ -156,6 +184,8 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+  ExecViewManaged<int*>             d_elem_order;
+  ExecViewManaged<int*>::HostMirror h_elem_order;
   // Helper used to accumulate connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,8 +197,15 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // In finalize call, after setup_ucon, sort elements into boundary/interior.
+  void setup_elem_order();
 };
 
+// Return the permutation that sorts the points pts(i,:) along a Hilbert
+// space-filling curve through their bounding box. Coordinates along which the
+// points do not vary are dropped, so that planar points follow a 2D curve.
+std::vector<int> hilbert_order (const HostViewUnmanaged<const Real*[3]>& pts);
+
 } // namespace Homme
 
 #endif // HOMMEXX_CONNECTIVITY_HPP
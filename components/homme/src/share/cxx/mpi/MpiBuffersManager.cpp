@@ -8,6 +8,10 @@
 
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
+#include "Hommexx_Debug.hpp"
+
+#include <cstring>
+#include <numeric>
 
 namespace Homme
 {
@@ -18,6 +22,12 @@ MpiBuffersManager::MpiBuffersManager ()
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_node_comm         (MPI_COMM_NULL)
+ , m_node_win          (MPI_WIN_NULL)
+ , m_node_rank         (-1)
+ , m_node_size         (0)
+ , m_node_header_size  (0)
+ , m_node_seq          (0)
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -41,6 +51,16 @@ MpiBuffersManager::~MpiBuffersManager ()
 
   // Check our buffers are not busy
   assert (!m_buffers_busy);
+
+  // The window and the node comm can only be freed while MPI is still up
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    free_node_window();
+    if (m_node_comm!=MPI_COMM_NULL) {
+      MPI_Comm_free(&m_node_comm);
+    }
+  }
 }
 
 void MpiBuffersManager::check_for_reallocation ()
@@ -77,12 +97,29 @@ void MpiBuffersManager::allocate_buffers ()
 
   // The buffers used for packing/unpacking
   m_send_buffer  = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
-  m_recv_buffer  = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
   m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
 
   // The buffers used in MPI calls
   m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
-  m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
+
+  if (is_node_shared_memory_enabled()) {
+    // The mpi recv buffer lives in the node-shared window
+    allocate_node_window();
+    m_mpi_recv_buffer = decltype(m_mpi_recv_buffer)();
+    if (std::is_same<MPIMemSpace,ExecMemSpace>::value) {
+      // Unpack straight from the window
+      m_recv_buffer = decltype(m_recv_buffer)();
+      m_recv_view = ExecViewUnmanaged<Real*>(m_mpi_recv_view.data(), m_mpi_buffer_size);
+    } else {
+      m_recv_buffer = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
+      m_recv_view = m_recv_buffer;
+    }
+  } else {
+    m_recv_buffer = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
+    m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
+    m_recv_view = m_recv_buffer;
+    m_mpi_recv_view = m_mpi_recv_buffer;
+  }
 
   m_views_are_valid = true;
 
@@ -99,6 +136,14 @@ void MpiBuffersManager::lock_buffers ()
   assert (!m_buffers_busy);
 
   m_buffers_busy = true;
+
+  // A new exchange starts. Since the previous one has completed, the on-node
+  // senders can now write in our mpi recv buffer.
+  ++m_node_seq;
+  if (m_node_win!=MPI_WIN_NULL) {
+    node_header(m_node_rank)[0] = m_node_seq;
+    MPI_Win_sync(m_node_win);
+  }
 }
 
 void MpiBuffersManager::unlock_buffers ()
@@ -108,6 +153,158 @@ void MpiBuffersManager::unlock_buffers ()
   m_buffers_busy = false;
 }
 
+bool MpiBuffersManager::enable_node_shared_memory ()
+{
+  if (is_node_shared_memory_enabled()) {
+    return true;
+  }
+
+  // Senders copy their data from their mpi send buffer, on host
+  if (!std::is_same<MPIMemSpace,HostMemSpace>::value) {
+    return false;
+  }
+
+  // We need the comm from the connectivity, and the buffers must not be allocated yet,
+  // since the mpi recv buffer is going to be placed in the shared window
+  assert (m_connectivity);
+  assert (m_send_buffer.data()==nullptr);
+
+  const auto& comm = m_connectivity->get_comm();
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Comm_split_type(comm.mpi_comm(), MPI_COMM_TYPE_SHARED, comm.rank(),
+                                              MPI_INFO_NULL, &m_node_comm),
+                          comm.mpi_comm());
+  MPI_Comm_rank(m_node_comm, &m_node_rank);
+  MPI_Comm_size(m_node_comm, &m_node_size);
+
+  // Map each rank in the connectivity comm to its rank in the node comm
+  MPI_Group group, node_group;
+  MPI_Comm_group(comm.mpi_comm(), &group);
+  MPI_Comm_group(m_node_comm, &node_group);
+  std::vector<int> pids(comm.size());
+  std::iota(pids.begin(), pids.end(), 0);
+  m_node_ranks.resize(comm.size());
+  MPI_Group_translate_ranks(group, comm.size(), pids.data(), node_group, m_node_ranks.data());
+  for (auto& node_rank : m_node_ranks) {
+    if (node_rank==MPI_UNDEFINED) {
+      node_rank = -1;
+    }
+  }
+  MPI_Group_free(&group);
+  MPI_Group_free(&node_group);
+
+  // The header stores 1+m_node_size sequence numbers. Pad it, so that the recv buffer
+  // starts on a cache line.
+  constexpr size_t line = 64;
+  m_node_header_size = ((1+m_node_size)*sizeof(long long) + line - 1) / line * line;
+
+  return true;
+}
+
+int MpiBuffersManager::get_node_rank (const int pid) const
+{
+  if (!is_node_shared_memory_enabled()) {
+    return -1;
+  }
+  assert (pid>=0 && pid<static_cast<int>(m_node_ranks.size()));
+  return m_node_ranks[pid];
+}
+
+void MpiBuffersManager::allocate_node_window ()
+{
+  free_node_window();
+
+  // MPI_Win_allocate_shared is collective on the node, and all the segments have the
+  // same size, so that we know the size of our neighbors' mpi recv buffers
+  unsigned long long buffer_size = m_mpi_buffer_size;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Allreduce(MPI_IN_PLACE, &buffer_size, 1, MPI_UNSIGNED_LONG_LONG,
+                                        MPI_MAX, m_node_comm),
+                          m_node_comm);
+  const MPI_Aint segment_size = m_node_header_size + buffer_size*sizeof(Real);
+  char* segment;
+  HOMMEXX_MPI_CHECK_ERROR(MPI_Win_allocate_shared(segment_size, 1, MPI_INFO_NULL, m_node_comm,
+                                                  &segment, &m_node_win),
+                          m_node_comm);
+  m_node_segments.resize(m_node_size);
+  for (int r=0; r<m_node_size; ++r) {
+    MPI_Aint size;
+    int disp_unit;
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Win_shared_query(m_node_win, r, &size, &disp_unit, &m_node_segments[r]),
+                            m_node_comm);
+  }
+  assert (m_node_segments[m_node_rank]==segment);
+
+  // We never lock/unlock the window again: all synchronization goes through the
+  // sequence numbers in the headers, with MPI_Win_sync acting as memory barrier.
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, m_node_win);
+
+  // Our recv buffer is free for the current exchange, and no data has been put in it.
+  // Do not let anyone look at the header before it is set.
+  volatile long long* header = node_header(m_node_rank);
+  header[0] = m_node_seq;
+  for (int r=0; r<m_node_size; ++r) {
+    header[1+r] = 0;
+  }
+  MPI_Win_sync(m_node_win);
+  MPI_Barrier(m_node_comm);
+
+  m_mpi_recv_view = MPIViewUnmanaged<Real*>(reinterpret_cast<Real*>(segment + m_node_header_size),
+                                            m_mpi_buffer_size);
+}
+
+void MpiBuffersManager::free_node_window ()
+{
+  if (m_node_win==MPI_WIN_NULL) {
+    return;
+  }
+
+  MPI_Win_unlock_all(m_node_win);
+  MPI_Win_free(&m_node_win);
+  m_node_segments.clear();
+  m_mpi_recv_view = MPIViewUnmanaged<Real*>();
+}
+
+void MpiBuffersManager::node_put (const int node_rank, const size_t send_offset,
+                                  const size_t recv_offset, const size_t count)
+{
+  // Only an ongoing exchange can put data
+  assert (m_node_win!=MPI_WIN_NULL && m_buffers_busy);
+  assert (node_rank>=0 && node_rank<m_node_size && node_rank!=m_node_rank);
+
+  // Wait until the receiver has started this exchange, that is, until it is
+  // done unpacking the previous one
+  volatile long long* header = node_header(node_rank);
+  while (header[0]<m_node_seq) {
+    MPI_Win_sync(m_node_win);
+  }
+  MPI_Win_sync(m_node_win);
+
+  Real* dst = reinterpret_cast<Real*>(m_node_segments[node_rank] + m_node_header_size) + recv_offset;
+  std::memcpy(dst, m_mpi_send_buffer.data() + send_offset, count*sizeof(Real));
+
+  // Make sure the data is visible before the flag is
+  MPI_Win_sync(m_node_win);
+  header[1+m_node_rank] = m_node_seq;
+  MPI_Win_sync(m_node_win);
+}
+
+void MpiBuffersManager::node_wait (const int node_rank)
+{
+  assert (m_node_win!=MPI_WIN_NULL && m_buffers_busy);
+  assert (node_rank>=0 && node_rank<m_node_size && node_rank!=m_node_rank);
+
+  // While spinning, poll the comm, so that the off-node messages of this
+  // exchange keep progressing in MPI implementations without async progress
+  const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+  volatile long long* header = node_header(m_node_rank);
+  while (header[1+node_rank]<m_node_seq) {
+    MPI_Win_sync(m_node_win);
+    int pending;
+    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, mpi_comm, &pending, MPI_STATUS_IGNORE);
+  }
+  // Make sure we do not read the data before the flag
+  MPI_Win_sync(m_node_win);
+}
+
 void MpiBuffersManager::add_customer (BoundaryExchange* add_me)
 {
   // We don't allow null customers (although this should never happen)
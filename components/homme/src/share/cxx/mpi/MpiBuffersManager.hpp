@@ -13,6 +13,8 @@
 #include <map>
 #include <memory>
 
+#include <mpi.h>
+
 #include "MpiHelpers.hpp"
 
 namespace Homme
@@ -70,6 +72,17 @@ class BoundaryExchange;
  * which is a no-op if the MPIMemSpace=ExecMemSpace, that is, if
  * the MPI is performed using pointers on the Execution Space.
  *
+ * Optionally, the BM can place the mpi_recv buffer in an MPI-3 shared
+ * memory window, allocated across the ranks of each node (see
+ * enable_node_shared_memory). In that case, a BE customer does not send
+ * MPI messages to the ranks on its own node: it copies its outgoing
+ * values straight into their mpi_recv buffers, and then raises a flag,
+ * which the receiver polls. This requires the MPI buffers to be on host.
+ * Since the window is allocated collectively, when this feature is on,
+ * all the ranks on a node must (re)allocate buffers at the same time.
+ * This is the case as long as all ranks register the same BE's and
+ * perform the same sequence of exchanges, which is how BE is used.
+ *
  */
 
 class MpiBuffersManager
@@ -99,6 +112,17 @@ public:
   // Allocate the buffers (overwriting possibly already allocated ones if needed)
   void allocate_buffers ();
 
+  // Place the mpi_recv buffer in a node-shared memory window, so that customers can
+  // exchange with on-node ranks without MPI messages. Must be called by all ranks,
+  // before the buffers are allocated. Returns false (and does nothing) if the MPI
+  // buffers are not on host.
+  bool enable_node_shared_memory ();
+  bool is_node_shared_memory_enabled () const { return m_node_comm!=MPI_COMM_NULL; }
+
+  // The rank of pid in the node communicator, or -1 if pid is on another node
+  // (or if the node-shared memory is not enabled)
+  int get_node_rank (const int pid) const;
+
   // Lock/unlock the buffers are busy
   void lock_buffers ();
   void unlock_buffers ();
@@ -130,6 +154,18 @@ private:
   // Note: these are no-ops if MPIMemSpace=ExecMemSpace
   void sync_send_buffer (BoundaryExchange* customer);
   void sync_recv_buffer (BoundaryExchange* customer);
+  // Same as above, but only for the entries [offset,offset+count) of the recv buffer
+  void sync_recv_buffer (BoundaryExchange* customer, const size_t offset, const size_t count);
+
+  // Node-shared memory transport. The exchange sequence number is advanced when the
+  // buffers are locked, at which point our mpi_recv buffer can be overwritten by the
+  // on-node senders.
+  // Copy the entries [send_offset,send_offset+count) of the mpi_send buffer into the
+  // mpi_recv buffer of the given node rank, starting at recv_offset, and notify it
+  void node_put (const int node_rank, const size_t send_offset,
+                 const size_t recv_offset, const size_t count);
+  // Wait until the given node rank has put its data in our mpi_recv buffer
+  void node_wait (const int node_rank);
 
   // Small struct, to hold customer's needs. We could use an std::pair, but this is more verbose
   struct CustomerNeeds {
@@ -178,6 +214,30 @@ private:
   MPIViewManaged<Real*>   m_mpi_send_buffer;
   MPIViewManaged<Real*>   m_mpi_recv_buffer;
 
+  // The recv buffers actually used. They are the views above, unless the node-shared
+  // memory is enabled, in which case the mpi recv buffer lives in the shared window
+  ExecViewUnmanaged<Real*> m_recv_view;
+  MPIViewUnmanaged<Real*>  m_mpi_recv_view;
+
+  // Node-shared memory window. Each rank's segment starts with a header, storing
+  // the sequence number of the last exchange it is ready for, and, for each node
+  // rank, the sequence number of the last exchange that rank has put data for.
+  // The mpi recv buffer follows the header.
+  void allocate_node_window ();
+  void free_node_window ();
+  volatile long long* node_header (const int node_rank) const {
+    return reinterpret_cast<volatile long long*>(m_node_segments[node_rank]);
+  }
+
+  MPI_Comm                m_node_comm;
+  MPI_Win                 m_node_win;
+  int                     m_node_rank;
+  int                     m_node_size;
+  size_t                  m_node_header_size;
+  std::vector<int>        m_node_ranks;
+  std::vector<char*>      m_node_segments;
+  long long               m_node_seq;
+
   // The blackhole send/recv buffers (used for missing connections)
   ExecViewManaged<Real*>  m_blackhole_send_buffer;
   ExecViewManaged<Real*>  m_blackhole_recv_buffer;
@@ -207,14 +267,26 @@ inline void MpiBuffersManager::sync_recv_buffer (BoundaryExchange* customer)
   const size_t customer_mpi_buffer_size = m_customers.find(customer)->second.mpi_buffer_size;
   if (customer_mpi_buffer_size<m_mpi_buffer_size) {
     // Avoid copying more than we need
-    MPIViewUnmanaged<const Real*>  mpi_recv_view(m_mpi_recv_buffer.data(),customer_mpi_buffer_size);
-    ExecViewUnmanaged<Real*> recv_view(m_recv_buffer.data(),customer_mpi_buffer_size);
+    MPIViewUnmanaged<const Real*>  mpi_recv_view(m_mpi_recv_view.data(),customer_mpi_buffer_size);
+    ExecViewUnmanaged<Real*> recv_view(m_recv_view.data(),customer_mpi_buffer_size);
     Kokkos::deep_copy(recv_view, mpi_recv_view);
   } else {
-    Kokkos::deep_copy(m_recv_buffer, m_mpi_recv_buffer);
+    Kokkos::deep_copy(m_recv_view, m_mpi_recv_view);
   }
 }
 
+inline void MpiBuffersManager::sync_recv_buffer (BoundaryExchange* customer,
+                                                 const size_t offset, const size_t count)
+{
+  // Only customers can call this
+  assert (m_customers.find(customer)!=m_customers.end());
+  assert (offset+count<=m_customers.find(customer)->second.mpi_buffer_size);
+
+  MPIViewUnmanaged<const Real*>  mpi_recv_view(m_mpi_recv_view.data()+offset,count);
+  ExecViewUnmanaged<Real*> recv_view(m_recv_view.data()+offset,count);
+  Kokkos::deep_copy(recv_view, mpi_recv_view);
+}
+
 inline ExecViewUnmanaged<Real*>
 MpiBuffersManager::get_send_buffer () const
 {
@@ -228,7 +300,7 @@ MpiBuffersManager::get_recv_buffer () const
 {
   // We ensure that the buffers are valid
   assert(m_views_are_valid);
-  return m_recv_buffer;
+  return m_recv_view;
 }
 
 inline ExecViewUnmanaged<Real*>
@@ -252,7 +324,7 @@ MpiBuffersManager::get_mpi_recv_buffer() const
 {
   // We ensure that the buffers are valid
   assert(m_views_are_valid);
-  return m_mpi_recv_buffer;
+  return m_mpi_recv_view;
 }
 
 inline ExecViewUnmanaged<Real*>
@@ -294,6 +366,11 @@ public:
     return m_bmm.at(MPI_EXCHANGE)->is_connectivity_set();
   }
 
+  bool enable_node_shared_memory () {
+    const bool enabled = m_bmm[MPI_EXCHANGE]->enable_node_shared_memory();
+    return m_bmm[MPI_EXCHANGE_MIN_MAX]->enable_node_shared_memory() && enabled;
+  }
+
   std::shared_ptr<MpiBuffersManager> operator() (int exchange_type) const {
     return m_bmm.at(exchange_type);
   }
@@ -92,6 +92,11 @@ struct CaarFunctorImpl {
   const bool          m_theta_hydrostatic_mode;
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
+  const bool          m_bndry_exchange_overlap;
+
+  // Elements processed by the pre-exchange kernel (all, unless overlapping the
+  // boundary exchange with computation)
+  ElementSubset       m_elems;
 
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
@@ -131,6 +136,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_bndry_exchange_overlap(params.bndry_exchange_overlap)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +160,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_bndry_exchange_overlap(params.bndry_exchange_overlap)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -304,6 +311,7 @@ struct CaarFunctorImpl {
       auto& be = *m_bes[tl];
       be.set_label(std::string("CAAR-") + std::to_string(tl));
       be.set_diagnostics_level(sp.internal_diagnostics_level);
+      be.set_progressive_unpack(sp.bndry_exchange_progressive_unpack);
       be.set_buffers_manager(bm_exchange);
       if (m_theta_hydrostatic_mode) {
         be.set_num_fields(0,0,4);
@@ -323,6 +331,13 @@ struct CaarFunctorImpl {
       }
       be.registration_completed();
     }
+
+    // Visit the boundary elements first to overlap the exchange, or else follow
+    // the SFC order, if any (see Connectivity::set_elem_order_sfc)
+    const auto& connectivity = Context::singleton().get<Connectivity>();
+    m_elems.order = (m_bndry_exchange_overlap ?
+                     connectivity.get_d_elem_order() :
+                     connectivity.get_d_elem_traversal());
   }
 
   void set_rk_stage_data (const RKStageData& data) {
@@ -345,18 +360,39 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_bndry_exchange_overlap) {
+      // Compute boundary elements, send their data, and compute the interior
+      // elements while the messages are in flight.
+      int nerr = 0;
+      GPTLstart("caar compute+bexchV");
+      m_bes[data.np1]->exchange_overlapped([&] (const int first, const int count) {
+          int nerr_subset;
+          m_elems.offset = first;
+          const TeamPolicyType<TagPreExchange> policy =
+            Homme::get_default_team_policy<ExecSpace,TagPreExchange>(count);
+          Kokkos::parallel_reduce("caar loop pre-boundary exchange", policy, *this, nerr_subset);
+          Kokkos::fence();
+          nerr += nerr_subset;
+        }, m_geometry.m_rspheremp);
+      m_elems.offset = 0;
+      Kokkos::fence();
+      GPTLstop("caar compute+bexchV");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    } else {
+      GPTLstart("caar compute");
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -376,6 +412,7 @@ struct CaarFunctorImpl {
     // Note: make sure the same temp is not used within each epoch!
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(kv.ie);
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
@@ -122,6 +122,8 @@ void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
 #else
   m_process_nh_vars = not params.theta_hydrostatic_mode;
 #endif
+
+  m_bndry_exchange_overlap = params.bndry_exchange_overlap;
 }
 
 void HyperviscosityFunctorImpl::setup(const ElementsGeometry&     geometry,
@@ -208,6 +210,7 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
     if (i == 1 && m_data.nu_top <= 0) continue;
     auto be = bes[i];
     be->set_diagnostics_level(sp.internal_diagnostics_level);
+    be->set_progressive_unpack(sp.bndry_exchange_progressive_unpack);
     const auto nlev = nlevs[i];
     be->set_buffers_manager(bm_exchange);
     if (m_process_nh_vars) {
@@ -224,6 +227,13 @@ void HyperviscosityFunctorImpl::init_boundary_exchanges () {
     be->register_field(m_buffers.vtens, 2, 0, nlev);
     be->registration_completed();
   }
+
+  // Visit the boundary elements first to overlap the exchange, or else follow
+  // the SFC order, if any (see Connectivity::set_elem_order_sfc)
+  const auto& connectivity = Context::singleton().get<Connectivity>();
+  m_elems.order = (m_bndry_exchange_overlap ?
+                   connectivity.get_d_elem_order() :
+                   connectivity.get_d_elem_traversal());
 }//initBE
 
 void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real eta_ave_w)
@@ -271,14 +281,22 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
-    Kokkos::fence();
-
-    // Exchange
     assert (m_be->is_registration_completed());
-    GPTLstart("hvf-bexch");
-    m_be->exchange();
-    GPTLstop("hvf-bexch");
+    if (m_bndry_exchange_overlap) {
+      GPTLstart("hvf-bexch");
+      m_be->exchange_overlapped([&] (const int first, const int count) {
+          run_on_elems<TagHyperPreExchange>(first, count);
+        });
+      GPTLstop("hvf-bexch");
+    } else {
+      Kokkos::parallel_for(m_policy_pre_exchange, *this);
+      Kokkos::fence();
+
+      // Exchange
+      GPTLstart("hvf-bexch");
+      m_be->exchange();
+      GPTLstop("hvf-bexch");
+    }
 
     // Update states
     Kokkos::parallel_for(m_policy_update_states, *this);
@@ -334,15 +352,24 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   // sponge layer 
   if (m_data.nu_top > 0) {
     for (int icycle = 0; icycle < m_data.hypervis_subcycle_tom; ++icycle) {
-      // laplace(fields) --> ttens, etc.
-      Kokkos::parallel_for(m_policy_nutop_laplace, *this);
-      Kokkos::fence();
-
       // exchange is done on ttens, dptens, vtens, etc.
       assert (m_be->is_registration_completed());
-      GPTLstart("hvf-bexch");
-      m_be_tom->exchange();
-      GPTLstop("hvf-bexch");
+      if (m_bndry_exchange_overlap) {
+        // laplace(fields) --> ttens, etc., overlapped with the exchange
+        GPTLstart("hvf-bexch");
+        m_be_tom->exchange_overlapped([&] (const int first, const int count) {
+            run_on_elems<TagNutopLaplace>(first, count);
+          });
+        GPTLstop("hvf-bexch");
+      } else {
+        // laplace(fields) --> ttens, etc.
+        Kokkos::parallel_for(m_policy_nutop_laplace, *this);
+        Kokkos::fence();
+
+        GPTLstart("hvf-bexch");
+        m_be_tom->exchange();
+        GPTLstop("hvf-bexch");
+      }
 
       Kokkos::parallel_for(m_policy_nutop_update_states, *this);
       Kokkos::fence();
@@ -355,14 +382,22 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
-  Kokkos::fence();
-
-  // Exchange
   assert (m_be->is_registration_completed());
-  GPTLstart("hvf-bexch");
-  m_be->exchange(m_geometry.m_rspheremp);
-  GPTLstop("hvf-bexch");
+  if (m_bndry_exchange_overlap) {
+    GPTLstart("hvf-bexch");
+    m_be->exchange_overlapped([&] (const int first, const int count) {
+        run_on_elems<TagFirstLaplaceHV>(first, count);
+      }, m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  } else {
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+    Kokkos::fence();
+
+    // Exchange
+    GPTLstart("hvf-bexch");
+    m_be->exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
+  }
 
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
@@ -380,6 +415,7 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMember& team) const {
   KernelVariables kv(team, m_tu);
+  kv.ie = m_elems(kv.ie);
 
   using MidColumn = decltype(Homme::subview(m_buffers.wtens,0,0,0));
 
@@ -113,6 +113,7 @@ public:
      using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(kv.ie);
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -316,6 +317,7 @@ public:
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(kv.ie);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -386,6 +388,15 @@ public:
 
 protected:
 
+  // Launch the kernel with the given tag on the elements
+  // m_elems.order(first:first+count-1) (see BoundaryExchange::exchange_overlapped)
+  template<typename Tag>
+  void run_on_elems (const int first, const int count) const {
+    auto f = *this;
+    f.m_elems.offset = first;
+    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace,Tag>(count), f);
+  }
+
   const int             m_num_elems;
   HyperviscosityData    m_data;
   ElementsState         m_state;
@@ -399,6 +410,12 @@ protected:
 
   bool m_process_nh_vars;
 
+  // If true, the kernels right before a boundary exchange run on boundary
+  // elements first, and on interior elements while the exchange is in flight.
+  bool m_bndry_exchange_overlap = false;
+  // Elements processed by those kernels (all, unless overlapping)
+  ElementSubset m_elems;
+
   // Policies
   Kokkos::TeamPolicy<ExecSpace,TagUpdateStates>     m_policy_update_states;
   Kokkos::TeamPolicy<ExecSpace,TagFirstLaplaceHV>   m_policy_first_laplace;
@@ -47,7 +47,9 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const int& use_cpstar, const int& transport_alg, const int& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const int& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const int& bndry_exchange_overlap, const int& bndry_exchange_shm,
+                               const int& bndry_exchange_progressive_unpack, const int& elem_sfc_order)
 {
 
   // Check that the simulation options are supported. This helps us in the future, since we
@@ -70,6 +72,10 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   Errors::check_option("init_simulation_params_c","vtheta_thresh",vtheta_thresh,0.0,Errors::ComparisonOp::GT);
   Errors::check_option("init_simulation_params_c","nu_div",nu_div,0.0,Errors::ComparisonOp::GT);
   Errors::check_option("init_simulation_params_c","theta_advection_form",theta_adv_form,{0,1});
+  Errors::check_option("init_simulation_params_c","bndry_exchange_overlap",bndry_exchange_overlap,{0,1});
+  Errors::check_option("init_simulation_params_c","bndry_exchange_shm",bndry_exchange_shm,{0,1});
+  Errors::check_option("init_simulation_params_c","bndry_exchange_progressive_unpack",bndry_exchange_progressive_unpack,{0,1});
+  Errors::check_option("init_simulation_params_c","elem_sfc_order",elem_sfc_order,{0,1});
 #ifndef SCREAM
   Errors::check_option("init_simulation_params_c","nsplit",nsplit,1,Errors::ComparisonOp::GE);
 #else
@@ -125,6 +131,10 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.bndry_exchange_overlap        = (bool)bndry_exchange_overlap;
+  params.bndry_exchange_shm            = (bool)bndry_exchange_shm;
+  params.bndry_exchange_progressive_unpack = (bool)bndry_exchange_progressive_unpack;
+  params.elem_sfc_order                = (bool)elem_sfc_order;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -282,7 +292,7 @@ void init_elements_c (const int& num_elems)
   const bool consthv = (params.hypervis_scaling==0.0);
   e.init (num_elems, consthv, /* alloc_gradphis = */ true,
           params.scale_factor, params.laplacian_rigid_factor,
-          /* alloc_sphere_coords = */ params.transport_alg > 0);
+          /* alloc_sphere_coords = */ params.transport_alg > 0 || params.elem_sfc_order);
 
   // Init also the tracers structure
   Tracers& t = c.create<Tracers> ();
@@ -581,6 +591,30 @@ void init_boundary_exchanges_c ()
   if (!bmm[MPI_EXCHANGE_MIN_MAX]->is_connectivity_set()) {
     bmm[MPI_EXCHANGE_MIN_MAX]->set_connectivity(connectivity);
   }
+  if (params.bndry_exchange_shm) {
+    // Must happen before any exchange allocates the buffers
+    const bool enabled = bmm.enable_node_shared_memory();
+    if (!enabled && connectivity->get_comm().root()) {
+      printf ("Note: bndry_exchange_shm=1 requires the MPI buffers on host. Using MPI for all exchanges.\n");
+    }
+  }
+  if (params.elem_sfc_order && !connectivity->is_elem_order_sfc()) {
+    // Must happen before the functors grab the element order below
+    const auto& geometry = c.get<ElementsGeometry>();
+    const auto sphere_cart = Kokkos::create_mirror_view(geometry.m_sphere_cart);
+    Kokkos::deep_copy(sphere_cart, geometry.m_sphere_cart);
+    HostViewManaged<Real*[3]> centers("element centers", sphere_cart.extent(0));
+    for (int ie = 0; ie < centers.extent_int(0); ++ie) {
+      for (int igp = 0; igp < NP; ++igp) {
+        for (int jgp = 0; jgp < NP; ++jgp) {
+          for (int d = 0; d < 3; ++d) {
+            centers(ie,d) += sphere_cart(ie,igp,jgp,d)/(NP*NP);
+          }
+        }
+      }
+    }
+    connectivity->set_elem_order_sfc(centers);
+  }
 
   if (params.qsize > 0) {
     if (params.transport_alg == 0) {
@@ -9,6 +9,8 @@
 #include "utilities/TestUtils.hpp"
 #include "Types.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <random>
 #include <iomanip>
 #include <iostream>
@@ -132,6 +134,24 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be3->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
   be3->registration_completed();
 
+  // Visit the elements in a scrambled order in the pack/unpack kernels. The
+  // results must not depend on it.
+  {
+    HostViewManaged<Real*[3]> centers("element centers", num_elements);
+    genRandArray(centers, engine, dreal);
+    connectivity->set_elem_order_sfc(centers);
+    REQUIRE (connectivity->get_d_elem_traversal().extent_int(0) == num_elements);
+  }
+
+  // Exchange with on-node ranks through the node-shared window in be1/be2, while
+  // be3 keeps using MPI for all its neighbors, so both paths are tested
+  buffers_manager->enable_node_shared_memory();
+
+  // All three exchanges in one message per neighbor
+  REQUIRE (BoundaryExchange::are_fusible({be1, be2, be3}));
+  REQUIRE (!BoundaryExchange::are_fusible({be1, be1}));
+  std::shared_ptr<BoundaryExchange> be123 = BoundaryExchange::fuse({be1, be2, be3}, buffers_manager);
+
   for (int itest=0; itest<num_tests; ++itest)
   {
     // Whether the neighbor min/max should be done as a whole or with two separate calls (start/pack_and_send and finish/recv_and_unpack)
@@ -205,7 +225,12 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
                                field_3d_int_f90.data(), field_4d_f90.data(),
                                DIM, NUM_TIME_LEVELS, field_2d_idim+1, field_3d_idim+1, field_4d_outer_idim+1, minmax_split);
     minmax_split = 1;
-    if (minmax_split==0) {
+    // Alternate the unpack strategy; both must match the f90 results exactly
+    be1->set_progressive_unpack(itest%2==0);
+    be2->set_progressive_unpack(itest%2==1);
+    if (itest%4==3) {
+      be123->exchange();
+    } else if (minmax_split==0) {
       be1->exchange();
       be2->exchange();
       be3->exchange_min_max();
@@ -213,8 +238,14 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be3->pack_and_send_min_max();
       be1->pack_and_send();
       be1->recv_and_unpack();
-      be2->pack_and_send();
-      be2->recv_and_unpack();
+      if (itest%3==2) {
+        // Remote connections packed and sent before the local ones; the fields
+        // are already computed, so there is nothing to overlap with
+        be2->exchange_overlapped([] (const int, const int) {});
+      } else {
+        be2->pack_and_send();
+        be2->recv_and_unpack();
+      }
       be3->recv_and_unpack_min_max();
     }
     Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
@@ -307,4 +338,95 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
   be1->clean_up();
   be2->clean_up();
   be3->clean_up();
+  be123->clean_up();
+}
+
+// Average time of a DSS-like kernel on an m x m periodic grid of elements stored
+// row by row: each element adds the adjacent edges of its four neighbors to its
+// own. The elements are visited in the order elems (empty for the identity).
+static Real time_neighbor_gather (const ExecViewUnmanaged<const Scalar*[NP][NP][NUM_LEV]>& fin,
+                                  const ExecViewUnmanaged<Scalar*[NP][NP][NUM_LEV]>& fout,
+                                  const ExecViewUnmanaged<const int*>& elems,
+                                  const int m, const int nrep)
+{
+  Kokkos::Timer timer;
+  // The first pass is a warmup
+  for (int rep = 0; rep <= nrep; ++rep) {
+    if (rep == 1) {
+      Kokkos::fence();
+      timer.reset();
+    }
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, m*m),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int ie = elems.size()==0 ? idx : elems(idx);
+      const int i = ie % m, j = ie / m;
+      const int s = i + ((j+m-1) % m)*m, n = i + ((j+1) % m)*m;
+      const int w = (i+m-1) % m + j*m, e = (i+1) % m + j*m;
+      for (int k = 0; k < NP; ++k) {
+        for (int ilev = 0; ilev < NUM_LEV; ++ilev) {
+          fout(ie,0,k,ilev)    = fin(ie,0,k,ilev)    + fin(s,NP-1,k,ilev);
+          fout(ie,NP-1,k,ilev) = fin(ie,NP-1,k,ilev) + fin(n,0,k,ilev);
+          fout(ie,k,0,ilev)    = fin(ie,k,0,ilev)    + fin(w,k,NP-1,ilev);
+          fout(ie,k,NP-1,ilev) = fin(ie,k,NP-1,ilev) + fin(e,k,0,ilev);
+        }
+      }
+    });
+  }
+  Kokkos::fence();
+  return timer.seconds()/nrep;
+}
+
+TEST_CASE ("Element SFC order", "Testing the Hilbert element order and its locality")
+{
+  // On a 2^k x 2^k grid of planar points, consecutive points along the Hilbert
+  // curve are grid neighbors, whatever the input order.
+  constexpr int n = 16;
+  std::vector<int> perm(n*n);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::mt19937_64 engine(Catch::rngSeed());
+  std::shuffle(perm.begin(), perm.end(), engine);
+  HostViewManaged<Real*[3]> pts("points", n*n);
+  for (int k = 0; k < n*n; ++k) {
+    pts(k,0) = perm[k] % n + 0.5;
+    pts(k,1) = perm[k] / n + 0.5;
+    pts(k,2) = 1;
+  }
+  const auto order = hilbert_order(pts);
+  REQUIRE (static_cast<int>(order.size()) == n*n);
+  {
+    std::vector<int> sorted(order);
+    std::sort(sorted.begin(), sorted.end());
+    for (int k = 0; k < n*n; ++k) REQUIRE (sorted[k] == k);
+  }
+  for (int k = 1; k < n*n; ++k) {
+    const int a = perm[order[k-1]], b = perm[order[k]];
+    REQUIRE (std::abs(a % n - b % n) + std::abs(a / n - b / n) == 1);
+  }
+}
+
+// Hidden from the default run, since it only times and allocates a large grid.
+// Run it explicitly with the [benchmark] tag.
+TEST_CASE ("Element SFC locality", "[.benchmark]")
+{
+  // A neighbor gather over elements numbered row by row, as a partitioner might
+  // number them, visited in storage and in Hilbert order.
+  constexpr int m = 128, nrep = 10;
+  const int ne = m*m;
+  ExecViewManaged<Scalar*[NP][NP][NUM_LEV]> fin("fin", ne), fout("fout", ne);
+  Kokkos::deep_copy(fin, Scalar(1.0));
+  HostViewManaged<Real*[3]> centers("centers", ne);
+  for (int ie = 0; ie < ne; ++ie) {
+    centers(ie,0) = ie % m;
+    centers(ie,1) = ie / m;
+  }
+  const auto sfc = hilbert_order(centers);
+  ExecViewManaged<int*> d_sfc("sfc order", ne);
+  const auto h_sfc = Kokkos::create_mirror_view(d_sfc);
+  for (int ie = 0; ie < ne; ++ie) h_sfc(ie) = sfc[ie];
+  Kokkos::deep_copy(d_sfc, h_sfc);
+
+  const Real t_storage = time_neighbor_gather(fin, fout, ExecViewUnmanaged<const int*>(), m, nrep);
+  const Real t_sfc = time_neighbor_gather(fin, fout, d_sfc, m, nrep);
+  std::cout << "Neighbor gather on " << m << "x" << m << " elements: storage order "
+            << t_storage << " s, SFC order " << t_sfc << " s\n";
 }
@@ -45,6 +45,8 @@ extern "C" {
   void run_trajectory_f90(Real t0, Real t1, bool independent_time_steps, Real* dep,
                           Real* dprecon);
   void run_sl_vertical_remap_bfb_f90(Real* diagnostic);
+  void slmm_set_q_float_comm(bool q_float);
+  void slmm_set_adaptive_halo(bool adaptive);
 } // extern "C"
 
 using CA4d = Kokkos::View<Real****, Kokkos::LayoutRight, Kokkos::HostSpace>;
@@ -404,6 +406,7 @@ TEST_CASE ("compose_transport_testing") {
   REQUIRE(compose::test::slmm_unittest() == 0);
   REQUIRE(compose::test::cedr_unittest() == 0);
   REQUIRE(compose::test::interpolate_unittest() == 0);
+  REQUIRE(compose::test::islmpi_q_float_unittest() == 0);
   REQUIRE(compose::test::cedr_unittest(s.get_comm().mpi_comm()) == 0);
 
   auto& ct = Context::singleton().get<ComposeTransport>();
@@ -475,6 +478,38 @@ TEST_CASE ("compose_transport_testing") {
     }
   }
 
+  { // 2D SL with the q halo messages in single precision
+    int nmax = s.nmax;
+    std::vector<Real> eval_d((s.nlev+1)*s.qsize), eval_f(eval_d.size());
+    ct.test_2d(false, nmax, eval_d);
+    slmm_set_q_float_comm(true);
+    ct.test_2d(false, nmax, eval_f);
+    slmm_set_q_float_comm(false);
+    if (s.get_comm().root()) {
+      const int n = s.nlev*s.qsize;
+      // Interpolation and the CDR run in double, so the float rounding of the
+      // messages perturbs the l2 errors only well below their magnitude.
+      for (int i = 0; i < n; ++i) REQUIRE(almost_equal(eval_d[i], eval_f[i], 1e-4));
+      // The CDR's global correction still conserves mass.
+      for (int i = n; i < n + s.qsize; ++i) REQUIRE(std::abs(eval_f[i]) <= 20*tol);
+    }
+  }
+
+  { // 2D SL with the departure point exchange pruned to the near ranks
+    int nmax = s.nmax;
+    std::vector<Real> eval_full((s.nlev+1)*s.qsize), eval_adapt(eval_full.size());
+    ct.test_2d(false, nmax, eval_full);
+    slmm_set_adaptive_halo(true);
+    ct.test_2d(false, nmax, eval_adapt);
+    slmm_set_adaptive_halo(false);
+    if (s.get_comm().root()) {
+      // Only the set of messages changes, not the data, so the results must
+      // be identical to those with the full halo.
+      for (size_t i = 0; i < eval_full.size(); ++i)
+        REQUIRE(eval_full[i] == eval_adapt[i]);
+    }
+  }
+
   } while (false); // do
   } catch (...) {}
   Session::delete_singleton();